@@ -1,14 +1,24 @@
 #include <iostream>
+#include <fstream>
 
 #include <chrono>
+#include <thread>
 
 #include <boost/range/irange.hpp>
 #include <boost/range/algorithm.hpp>
 
 #include "GridSolverFactory.hpp"
+#include "GridSize.hpp"
+#include "GridSolverWithoutHypothesis.hpp"
+#include "GridPossibilitiesUpdater.hpp"
+#include "RelatedPossibilitiesRemover.hpp"
+#include "UniquePossibilitySetter.hpp"
+#include "PatternPossibilitiesRemover.hpp"
 #include "GridStatus.hpp"
+#include "GridText.hpp"
 #include "Grid.hpp"
 #include "Position.hpp"
+#include "UnitsFold.hpp"
 #include "Value.hpp"
 #include "utils/Utils.hpp"
 
@@ -45,28 +55,63 @@ int GetMedian(std::vector<int> v)
     return v[middle];
 }
 
-int main ()
+int GetPercentile(std::vector<int> v, int percentile)
 {
-    std::cout << "Multithreaded Sudoku Solver" << std::endl;
+    const auto rank = (v.size() - 1) * percentile / 100;
+    std::nth_element(v.begin(), v.begin() + rank, v.end());
+    return v[rank];
+}
 
-    const int gridSize {9};
-    const int cellsKept {20};
+void PrintDurations(std::string const& benchmarkName, std::vector<int> const& durations)
+{
+    std::cout << benchmarkName << std::endl;
 
-    const auto positionsValues = CreatePositionsValues9x9();
+    std::cout << "number of execution: " << durations.size() << std::endl;
 
-    auto gridSolver = GridSolverFactory::Make();
+    const auto median = GetMedian(durations);
 
+    std::vector<int> absDeviations(durations.size());
+    boost::transform(durations, absDeviations.begin(), [median](int val){ return std::abs(val - median); });
+
+    const auto mad = GetMedian(std::move(absDeviations));
+
+    std::cout << "median duration: " << median << " micro seconds" << std::endl;
+    std::cout << "median absolute deviation duration: " << mad << " micro seconds" << std::endl;
+    std::cout << "99th percentile duration: " << GetPercentile(durations, 99) << " micro seconds" << std::endl;
+}
+
+// One grid per line, see ParsePositionsValues
+std::vector<PositionsValues> LoadGrids(std::string const& fileName)
+{
+    std::ifstream file {std::string(BENCHMARK_CORPUS_DIR) + "/" + fileName};
+
+    if (!file)
+        throw std::runtime_error("Can't open benchmark corpus '" + fileName + "'");
+
+    std::vector<PositionsValues> grids;
+
+    for (std::string line; std::getline(file, line);)
+    {
+        if (!line.empty())
+            grids.push_back(ParsePositionsValues(line));
+    }
+
+    return grids;
+}
+
+template<typename TCreateGrid>
+std::vector<int> MeasureSolveDurations(GridSolver const& gridSolver, int testExecutionCount, TCreateGrid createGrid)
+{
     std::vector<int> durations;
 
-    const int testExecutionCount = 2'000;
-    for([[gnu::unused]] int i : boost::irange(0, testExecutionCount))
+    for(int i : boost::irange(0, testExecutionCount))
     {
-        auto grid = CreateGrid(gridSize, KeepRandomCells(positionsValues, cellsKept));
+        auto grid = createGrid(i);
 
         try
         {
             const auto beg = std::chrono::high_resolution_clock::now();
-            const auto solvedCorrectly = gridSolver->Solve(grid);
+            const auto solvedCorrectly = gridSolver.Solve(grid);
             const auto end = std::chrono::high_resolution_clock::now();
 
             if (!solvedCorrectly)
@@ -77,21 +122,453 @@ int main ()
         }
         catch(std::exception& e)
         {
-            std::cout << "Couldn't solve grid " << std::endl << grid << std::endl << " because: " << e.what() << std::endl;
+            std::cout << "Couldn't solve grid " << std::endl << PrettyGrid {grid} << std::endl << " because: " << e.what() << std::endl;
         }
     }
 
-    std::cout << "number of execution: " << durations.size() << std::endl;
+    return durations;
+}
 
-    const auto median = GetMedian(durations);
+// Values of the grids one after the other, as solved by the batch grid solvers
+std::vector<std::uint8_t> PackGrids(std::vector<Grid> const& grids)
+{
+    const auto cellsCount = grids[0].GetCellsCount();
+    std::vector<std::uint8_t> values(grids.size() * cellsCount);
 
-    std::vector<int> absDeviations(durations.size());
-    boost::transform(durations, absDeviations.begin(), [median](int val){ return std::abs(val - median); });
+    for (std::size_t i = 0; i < grids.size(); i++)
+        PackValues(grids[i], values.data() + i * cellsCount);
 
-    const auto mad = GetMedian(std::move(absDeviations));
+    return values;
+}
 
-    std::cout << "median duration: " << median << " micro seconds" << std::endl;
-    std::cout << "median absolute deviation duration: " << mad << " micro seconds" << std::endl;
+// Each duration is for solving all the grids returned by createGrids
+template<typename TCreateGrids, typename TSolve>
+std::vector<int> MeasureBatchDurations(int testExecutionCount, TCreateGrids createGrids, TSolve solve)
+{
+    std::vector<int> durations;
+
+    for([[gnu::unused]] int i : boost::irange(0, testExecutionCount))
+    {
+        auto grids = createGrids();
+
+        const auto beg = std::chrono::high_resolution_clock::now();
+        const auto solved = solve(grids);
+        const auto end = std::chrono::high_resolution_clock::now();
+
+        if (boost::count(solved, false) != 0)
+            std::cout << "Grid solved incorrectly by solver" << std::endl;
+
+        durations.push_back(std::chrono::duration_cast<std::chrono::microseconds>(end - beg).count());
+    }
+
+    return durations;
+}
+
+// Each call is a node of the search: the initial propagation, then one per hypothesis tried
+class CountingGridSolverWithoutHypothesis final : public GridSolverWithoutHypothesis
+{
+public:
+    CountingGridSolverWithoutHypothesis(std::unique_ptr<GridSolverWithoutHypothesis> gridSolverWithoutHypothesis, int& nodesCount) :
+        m_GridSolverWithoutHypothesis(std::move(gridSolverWithoutHypothesis)),
+        m_NodesCount(nodesCount)
+    {}
+
+    GridStatus Solve(Grid& grid, FoundPositions& foundPositions) const override
+    {
+        m_NodesCount++;
+        return m_GridSolverWithoutHypothesis->Solve(grid, foundPositions);
+    }
+
+private:
+    std::unique_ptr<GridSolverWithoutHypothesis> m_GridSolverWithoutHypothesis;
+    int& m_NodesCount;
+};
+
+std::string GetName(Deduction deduction)
+{
+    switch (deduction)
+    {
+    case Deduction::LockedCandidates : return "locked candidates";
+    case Deduction::NakedSubsets : return "naked subsets";
+    case Deduction::HiddenSubsets : return "hidden subsets";
+    }
+
+    return "unknown deduction";
+}
+
+void PrintDeductionProfile(std::string const& deductionName, DeductionProfile const& profile, int gridsCount)
+{
+    std::cout << "  " << deductionName << " per grid: "
+              << static_cast<double>(profile.m_Tries) / gridsCount << " tries, "
+              << static_cast<double>(profile.m_Hits) / gridsCount << " hits, "
+              << static_cast<double>(profile.m_PossibilitiesRemoved) / gridsCount << " possibilities removed, "
+              << profile.m_Cycles / gridsCount << " cycles" << std::endl;
+}
+
+template<int TGridSize>
+std::unique_ptr<GridSolver> MakeCountingGridSolver(Deductions const& deductions, Branching branching, int& nodesCount)
+{
+    return std::make_unique<GridSolverWithHypothesisImpl<>>(
+                std::make_unique<CountingGridSolverWithoutHypothesis>(
+                    std::make_unique<GridSolverWithoutHypothesisImpl<>>(
+                        std::make_unique<GridPossibilitiesUpdaterImpl<>>(std::make_unique<RelatedPossibilitiesRemoverImpl<TGridSize>>()),
+                        std::make_unique<UniquePossibilitySetterImpl<TGridSize>>(),
+                        std::make_unique<PatternPossibilitiesRemoverImpl<TGridSize>>(deductions)),
+                    nodesCount),
+                GridSolverFactory::MakeBranchingStrategy(branching));
+}
+
+// A single call of a kernel is too short to be measured, each duration is for 1'000 calls
+template<typename TKernel>
+std::vector<int> MeasureKernelDurations(Grid const& grid, int testExecutionCount, TKernel kernel)
+{
+    constexpr int callsPerMeasure {1'000};
+
+    std::vector<int> durations;
+    PossibilitiesBitSet checksum {};
+
+    for([[gnu::unused]] int i : boost::irange(0, testExecutionCount))
+    {
+        const auto beg = std::chrono::high_resolution_clock::now();
+
+        for([[gnu::unused]] int call : boost::irange(0, callsPerMeasure))
+            checksum ^= kernel(grid).m_DuplicatedValues[call % grid.GetGridSize()];
+
+        const auto end = std::chrono::high_resolution_clock::now();
+
+        durations.push_back(std::chrono::duration_cast<std::chrono::microseconds>(end - beg).count());
+    }
+
+    if (checksum != 0)
+        std::cout << "Unexpected duplicated values in solved grid" << std::endl;
+
+    return durations;
+}
+
+int main ()
+{
+    std::cout << "Multithreaded Sudoku Solver" << std::endl;
+
+    const int gridSize {9};
+    const int cellsKept {20};
+
+    const auto positionsValues = CreatePositionsValues9x9();
+
+    auto gridSolver = GridSolverFactory::Make();
+
+    std::vector<std::pair<std::string, std::unique_ptr<GridSolver>>> otherEngineGridSolvers;
+    otherEngineGridSolvers.emplace_back("digit planes engine", GridSolverFactory::Make(SolverEngine::DigitPlanes));
+    otherEngineGridSolvers.emplace_back("dancing links engine", GridSolverFactory::Make(SolverEngine::DancingLinks));
+
+    // Measured with the default engine, then with each of the others
+    auto measureEachEngine = [&](std::string const& benchmarkName, int testExecutionCount, auto createGrid)
+        {
+            PrintDurations(benchmarkName, MeasureSolveDurations(*gridSolver, testExecutionCount, createGrid));
+
+            for (auto const& [engineName, engineGridSolver] : otherEngineGridSolvers)
+                PrintDurations(benchmarkName + " - " + engineName, MeasureSolveDurations(*engineGridSolver, testExecutionCount, createGrid));
+        };
+
+    measureEachEngine("9x9 grids with 20 random cells kept", 2'000,
+        [&](int){ return CreateGrid(gridSize, KeepRandomCells(positionsValues, cellsKept)); });
+
+    measureEachEngine("9x9 grids with 17 random cells kept (near empty)", 500,
+        [&](int){ return CreateGrid(gridSize, KeepRandomCells(positionsValues, 17)); });
+
+    const auto hardGrids = CreateHardGrids9x9();
+    auto createHardGrid = [&](int i){ return CreateGrid(gridSize, hardGrids[i % hardGrids.size()]); };
+
+    measureEachEngine("Hard 9x9 grids (backtrack heavy)", 20 * hardGrids.size(), createHardGrid);
+
+    auto dynamicallyComposedGridSolver = GridSolverFactory::MakeDynamicallyComposed<gridSize>();
+
+    PrintDurations("Hard 9x9 grids (backtrack heavy) - solver composed through virtual interfaces",
+        MeasureSolveDurations(*dynamicallyComposedGridSolver, 20 * hardGrids.size(), createHardGrid));
+
+    // Only the grids needing many hypotheses can pay for the tasks
+    auto parallelGridSolver = GridSolverFactory::MakeParallel({});
+
+    PrintDurations("Hard 9x9 grids (backtrack heavy) - hypotheses searched in parallel",
+        MeasureSolveDurations(*parallelGridSolver, 20 * hardGrids.size(), createHardGrid));
+
+    PrintDurations("9x9 grids with 17 random cells kept (near empty) - hypotheses searched in parallel",
+        MeasureSolveDurations(*parallelGridSolver, 500, [&](int){ return CreateGrid(gridSize, KeepRandomCells(positionsValues, 17)); }));
+
+    // The whole tree is searched for a second solution, compared with the durations of the first solution above
+    auto solutionsFinder = GridSolverFactory::MakeSolutionsFinder();
+
+    std::vector<int> uniquenessDurations;
+    for(int i : boost::irange(0, static_cast<int>(20 * hardGrids.size())))
+    {
+        const auto grid = createHardGrid(i);
+
+        const auto beg = std::chrono::high_resolution_clock::now();
+        const auto solutionsCount = solutionsFinder->CountSolutions(grid, 2);
+        const auto end = std::chrono::high_resolution_clock::now();
+
+        if (solutionsCount != 1)
+            std::cout << "Unexpected solutions count " << solutionsCount << std::endl;
+
+        uniquenessDurations.push_back(std::chrono::duration_cast<std::chrono::microseconds>(end - beg).count());
+    }
+
+    PrintDurations("Hard 9x9 grids (backtrack heavy) - uniqueness of the solution checked", uniquenessDurations);
+
+    const std::vector<std::pair<std::string, std::vector<Deduction>>> deductionOrders
+        {
+            {"no deduction", {}},
+            {"locked candidates", {Deduction::LockedCandidates}},
+            {"naked subsets", {Deduction::NakedSubsets}},
+            {"hidden subsets", {Deduction::HiddenSubsets}},
+            {"locked candidates, naked subsets, hidden subsets", {Deduction::LockedCandidates, Deduction::NakedSubsets, Deduction::HiddenSubsets}},
+            {"hidden subsets, naked subsets, locked candidates", {Deduction::HiddenSubsets, Deduction::NakedSubsets, Deduction::LockedCandidates}}
+        };
+
+    // Fewer nodes only pay off if they save more than the deductions cost.
+    // The nodes and the profile come from a first run, so that the durations don't include the profiling.
+    auto measureEachDeductions = [&](auto gridSizeConstant, std::string const& benchmarkName, int testExecutionCount, auto createGrid)
+        {
+            for (auto const& [deductionsName, deductionOrder] : deductionOrders)
+            {
+                DeductionsProfile profile;
+                int nodesCount {0};
+
+                auto countingGridSolver = MakeCountingGridSolver<decltype(gridSizeConstant)::value>({deductionOrder, &profile}, Branching::FewestPossibilities, nodesCount);
+                MeasureSolveDurations(*countingGridSolver, testExecutionCount, createGrid);
+
+                PrintDurations(benchmarkName + " - " + deductionsName,
+                    MeasureSolveDurations(*GridSolverFactory::Make(SolverEngine::Cells, {deductionOrder}), testExecutionCount, createGrid));
+
+                std::cout << "mean nodes per grid: " << static_cast<double>(nodesCount) / testExecutionCount << std::endl;
+
+                for (auto deduction : deductionOrder)
+                    PrintDeductionProfile(GetName(deduction), profile[static_cast<int>(deduction)], testExecutionCount);
+            }
+        };
+
+    measureEachDeductions(GridSizeConstant<gridSize>{}, "Hard 9x9 grids (backtrack heavy)", 20 * hardGrids.size(), createHardGrid);
+
+    std::vector<PositionsValues> sparseGrids;
+    for([[gnu::unused]] int i : boost::irange(0, 200))
+        sparseGrids.push_back(KeepRandomCells(positionsValues, 17));
+
+    measureEachDeductions(GridSizeConstant<gridSize>{}, "9x9 grids with 17 random cells kept (near empty)", 2 * sparseGrids.size(),
+        [&](int i){ return CreateGrid(gridSize, sparseGrids[i % sparseGrids.size()]); });
+
+    std::vector<PositionsValues> easyGrids;
+    for([[gnu::unused]] int i : boost::irange(0, 200))
+        easyGrids.push_back(KeepRandomCells(positionsValues, 35));
+
+    measureEachDeductions(GridSizeConstant<gridSize>{}, "9x9 grids with 35 random cells kept (easy)", 2 * easyGrids.size(),
+        [&](int i){ return CreateGrid(gridSize, easyGrids[i % easyGrids.size()]); });
+
+    const auto grids16x16 = LoadGrids("grids16x16.txt");
+
+    measureEachDeductions(GridSizeConstant<16>{}, "16x16 grids from corpus", grids16x16.size(),
+        [&](int i){ return CreateGrid(16, grids16x16[i % grids16x16.size()]); });
+
+    const std::vector<std::pair<std::string, Branching>> branchings
+        {
+            {"cell with fewest possibilities, highest value first", Branching::FewestPossibilities},
+            {"least constraining value first", Branching::LeastConstrainingValue},
+            {"ties broken by most cells left in units", Branching::MostConstrainedUnits},
+            {"cells of a unit when fewer", Branching::UnitCells}
+        };
+
+    // The tail shows the grids where a branching goes astray
+    auto measureEachBranching = [&](std::string const& benchmarkName, int testExecutionCount, auto createGrid)
+        {
+            for (auto const& [branchingName, branching] : branchings)
+            {
+                PrintDurations(benchmarkName + " - " + branchingName,
+                    MeasureSolveDurations(*GridSolverFactory::Make(SolverEngine::Cells, {}, branching), testExecutionCount, createGrid));
+            }
+        };
+
+    measureEachBranching("Hard 9x9 grids (backtrack heavy)", 20 * hardGrids.size(), createHardGrid);
+
+    measureEachBranching("9x9 grids with 17 random cells kept (near empty)", 2 * sparseGrids.size(),
+        [&](int i){ return CreateGrid(gridSize, sparseGrids[i % sparseGrids.size()]); });
+
+    measureEachBranching("16x16 grids from corpus", grids16x16.size(),
+        [&](int i){ return CreateGrid(16, grids16x16[i % grids16x16.size()]); });
+
+    const auto grids25x25 = LoadGrids("grids25x25.txt");
+
+    measureEachBranching("25x25 grids from corpus", grids25x25.size(),
+        [&](int i){ return CreateGrid(25, grids25x25[i % grids25x25.size()]); });
+
+    auto createEasyGrids = [&]
+        {
+            std::vector<Grid> grids;
+
+            for([[gnu::unused]] int i : boost::irange(0, 256))
+                grids.push_back(CreateGrid(gridSize, KeepRandomCells(positionsValues, 35)));
+
+            return grids;
+        };
+
+    PrintDurations("256 9x9 grids with 35 random cells kept - solved one by one",
+        MeasureBatchDurations(50, createEasyGrids, [&](std::vector<Grid>& grids)
+            {
+                std::vector<bool> solved;
+
+                for (auto& grid : grids)
+                    solved.push_back(gridSolver->Solve(grid));
+
+                return solved;
+            }));
+
+    auto batchGridSolver = GridSolverFactory::MakeBatch();
+
+    PrintDurations("256 9x9 grids with 35 random cells kept - solved in batches",
+        MeasureBatchDurations(50, [&]{ return PackGrids(createEasyGrids()); },
+            [&](std::vector<std::uint8_t>& values){ return batchGridSolver->Solve(gridSize, values.data(), values.size() / (gridSize * gridSize)); }));
+
+    // Hard grids among easy ones: a static split of the batch would leave most threads idle
+    std::vector<PositionsValues> skewedGrids;
+    for(int i : boost::irange(0, 1'024))
+        skewedGrids.push_back(i % 32 == 0 ? hardGrids[i / 32 % hardGrids.size()] : KeepRandomCells(positionsValues, 30));
+
+    auto createSkewedGrids = [&]
+        {
+            std::vector<Grid> grids;
+
+            for (auto const& gridPositionsValues : skewedGrids)
+                grids.push_back(CreateGrid(gridSize, gridPositionsValues));
+
+            return PackGrids(grids);
+        };
+
+    std::cout << "1'024 9x9 grids, 1 in 32 hard - throughput by threads count" << std::endl;
+
+    for (const int threadsCount : {1, 2, 4, 8, static_cast<int>(std::thread::hardware_concurrency())})
+    {
+        auto parallelBatchGridSolver = GridSolverFactory::MakeParallelBatch(threadsCount);
+
+        const auto durations = MeasureBatchDurations(20, createSkewedGrids,
+            [&](std::vector<std::uint8_t>& values){ return parallelBatchGridSolver->Solve(gridSize, values.data(), skewedGrids.size()); });
+
+        std::cout << "  " << threadsCount << " threads: "
+                  << static_cast<long long>(skewedGrids.size()) * 1'000'000 / std::max(1, GetMedian(durations)) << " grids per second" << std::endl;
+    }
+
+    // Grids with many solutions, each one enumerated up to 100'000 solutions
+    std::vector<PositionsValues> underConstrainedGrids;
+    for([[gnu::unused]] int i : boost::irange(0, 8))
+        underConstrainedGrids.push_back(KeepRandomCells(positionsValues, 20));
+
+    std::cout << "8 9x9 grids with 20 random cells kept - solutions enumerated by threads count" << std::endl;
+
+    auto measureEnumeration = [&](SolutionsFinder const& solutionsFinder)
+        {
+            std::int64_t solutionsCount {0};
+
+            const auto beg = std::chrono::high_resolution_clock::now();
+
+            for (auto const& gridPositionsValues : underConstrainedGrids)
+                solutionsCount += solutionsFinder.CountSolutions(CreateGrid(gridSize, gridPositionsValues), 100'000);
+
+            const auto end = std::chrono::high_resolution_clock::now();
+
+            const auto duration = std::chrono::duration_cast<std::chrono::microseconds>(end - beg).count();
+
+            return solutionsCount * 1'000'000 / std::max<std::int64_t>(1, duration);
+        };
+
+    std::cout << "  sequential: " << measureEnumeration(*solutionsFinder) << " solutions per second" << std::endl;
+
+    for (const int threadsCount : {1, 2, 4, 8, static_cast<int>(std::thread::hardware_concurrency())})
+    {
+        ParallelSearch parallelSearch;
+        parallelSearch.m_ThreadsCount = threadsCount;
+
+        auto parallelSolutionsFinder = GridSolverFactory::MakeParallelSolutionsFinder(parallelSearch);
+
+        std::cout << "  " << threadsCount << " threads: " << measureEnumeration(*parallelSolutionsFinder) << " solutions per second" << std::endl;
+    }
+
+    // Each grid from its own random solution, the clues removed while the solution stays unique
+    for (const auto symmetry : {Symmetry::None, Symmetry::Central})
+    {
+        PuzzleGeneration puzzleGeneration;
+        puzzleGeneration.m_Symmetry = symmetry;
+
+        std::cout << "9x9 grids generated with at most " << puzzleGeneration.m_CluesCount << " clues"
+                  << (symmetry == Symmetry::Central ? ", symmetric" : "") << " - throughput by threads count" << std::endl;
+
+        for (const int threadsCount : {1, 2, 4, 8, static_cast<int>(std::thread::hardware_concurrency())})
+        {
+            auto gridGenerator = GridSolverFactory::MakeGenerator(puzzleGeneration, threadsCount);
+
+            const int gridsCount {2'000};
+
+            const auto beg = std::chrono::high_resolution_clock::now();
+            const auto grids = gridGenerator->Generate(gridsCount, 0);
+            const auto end = std::chrono::high_resolution_clock::now();
+
+            const auto duration = std::chrono::duration_cast<std::chrono::microseconds>(end - beg).count();
+
+            std::cout << "  " << threadsCount << " threads: " << static_cast<long long>(grids.size()) * 1'000'000 / std::max<long long>(1, duration)
+                      << " grids per second, " << gridsCount - grids.size() << " left out" << std::endl;
+        }
+    }
+
+    for (const int largeGridSize : {16, 25})
+    {
+        const auto gridSizeName = std::to_string(largeGridSize) + "x" + std::to_string(largeGridSize);
+        const auto largeGrids = LoadGrids("grids" + gridSizeName + ".txt");
+
+        measureEachEngine(gridSizeName + " grids from corpus", 3 * largeGrids.size(),
+            [&](int i){ return CreateGrid(largeGridSize, largeGrids[i % largeGrids.size()]); });
+    }
+
+    // Each duration is for decoding all the lines of the hard grids, 1'000 times
+    std::vector<std::string> hardGridLines;
+    for (auto const& hardGrid : hardGrids)
+        hardGridLines.push_back(FormatGrid(CreateGrid(gridSize, hardGrid)));
+
+    auto measureDecodeDurations = [&](auto decode)
+        {
+            std::vector<int> durations;
+            int unsetCellsCount {0};
+
+            for([[gnu::unused]] int i : boost::irange(0, 100))
+            {
+                const auto beg = std::chrono::high_resolution_clock::now();
+
+                for([[gnu::unused]] int call : boost::irange(0, 1'000))
+                    for (auto const& line : hardGridLines)
+                        unsetCellsCount += decode(line).GetUnsetCellsCount();
+
+                const auto end = std::chrono::high_resolution_clock::now();
+
+                durations.push_back(std::chrono::duration_cast<std::chrono::microseconds>(end - beg).count());
+            }
+
+            if (unsetCellsCount == 0)
+                std::cout << "Unexpected grids without unset cells" << std::endl;
+
+            return durations;
+        };
+
+    PrintDurations("Decoding of the hard 9x9 grid lines, 1'000 times - straight into the grids",
+        measureDecodeDurations([](std::string const& line){ return ParseGrid(line); }));
+
+    PrintDurations("Decoding of the hard 9x9 grid lines, 1'000 times - through positions and values",
+        measureDecodeDurations([](std::string const& line){ return CreateGrid(9, ParsePositionsValues(line)); }));
+
+    for (const int kernelGridSize : {9, 25})
+    {
+        const auto gridSizeName = std::to_string(kernelGridSize) + "x" + std::to_string(kernelGridSize);
+        const auto solvedGrid = CreateGrid(kernelGridSize, CreateSolvedPositionsValues(kernelGridSize));
+
+        PrintDurations("Fold of the units of a solved " + gridSizeName + " grid, 1'000 calls - vector instructions",
+            MeasureKernelDurations(solvedGrid, 200, [](Grid const& grid){ return FoldSetValues(grid); }));
+
+        PrintDurations("Fold of the units of a solved " + gridSizeName + " grid, 1'000 calls - scalar",
+            MeasureKernelDurations(solvedGrid, 200, [](Grid const& grid){ return detail::FoldSetValuesScalar(grid); }));
+    }
 
     return 0;
 }
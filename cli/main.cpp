@@ -0,0 +1,91 @@
+#include <exception>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "GridSolverFactory.hpp"
+#include "MappedFile.hpp"
+
+using namespace sudoku;
+
+// Solves the grids of the files given, or of the standard input, one grid per line (see ParseGrid),
+// and writes their solutions on the standard output in the same order.
+// The files are mapped in memory rather than read through a stream.
+
+void PrintUsage()
+{
+    std::cerr << "Usage: sudoku_solver_cli [-t threads] [file...]" << std::endl
+              << "Reads the standard input when no file is given, or for the file '-'." << std::endl;
+}
+
+int main(int argc, char* argv[])
+{
+    std::ios::sync_with_stdio(false);
+
+    int threadsCount {0};
+    std::vector<std::string> fileNames;
+
+    try
+    {
+        for (int i = 1; i < argc; i++)
+        {
+            const std::string arg {argv[i]};
+
+            if ((arg == "-t" || arg == "--threads") && i + 1 < argc)
+            {
+                threadsCount = std::stoi(argv[++i]);
+            }
+            else if (arg == "-h" || arg == "--help")
+            {
+                PrintUsage();
+                return 0;
+            }
+            else if (arg.size() > 1 && arg.front() == '-')
+            {
+                PrintUsage();
+                return 1;
+            }
+            else
+            {
+                fileNames.push_back(arg);
+            }
+        }
+
+        if (fileNames.empty())
+            fileNames.push_back("-");
+
+        auto streamGridSolver = GridSolverFactory::MakeStream(threadsCount);
+
+        StreamSolveReport report;
+
+        for (auto const& fileName : fileNames)
+        {
+            StreamSolveReport fileReport;
+
+            if (fileName == "-")
+            {
+                fileReport = streamGridSolver->Solve(std::cin, std::cout);
+            }
+            else
+            {
+                MappedFile file {fileName};
+                fileReport = streamGridSolver->Solve(file.GetContent(), std::cout);
+            }
+
+            report.m_GridsCount += fileReport.m_GridsCount;
+            report.m_UnsolvedGridsCount += fileReport.m_UnsolvedGridsCount;
+            report.m_InvalidLinesCount += fileReport.m_InvalidLinesCount;
+        }
+
+        std::cerr << report.m_GridsCount << " grids, "
+                  << report.m_UnsolvedGridsCount << " without solution, "
+                  << report.m_InvalidLinesCount << " invalid lines" << std::endl;
+
+        return report.m_UnsolvedGridsCount == 0 && report.m_InvalidLinesCount == 0 ? 0 : 2;
+    }
+    catch (std::exception const& e)
+    {
+        std::cerr << e.what() << std::endl;
+        return 1;
+    }
+}
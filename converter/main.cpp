@@ -0,0 +1,165 @@
+#include <fstream>
+#include <algorithm>
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+#include "GridRecords.hpp"
+#include "GridText.hpp"
+#include "MappedFile.hpp"
+
+using namespace sudoku;
+
+// Converts grids between the text format, one grid per line (see ParseGrid), and the grid records (see GridRecordsKind).
+
+void PrintUsage()
+{
+    std::cerr << "Usage:" << std::endl
+              << "  sudoku_grid_converter to-records <grids text file> <grids records file>" << std::endl
+              << "  sudoku_grid_converter solutions-to-records <grids text file> <solutions text file> <solutions records file>" << std::endl
+              << "  sudoku_grid_converter to-text <grids records file> [<solutions records file>]" << std::endl
+              << "to-text writes the grids, or their solutions when given, to the standard output." << std::endl;
+}
+
+// Next non empty line, empty once there is none left
+std::string_view TakeLine(std::string_view& text)
+{
+    while (!text.empty())
+    {
+        const auto lineEnd = std::min(text.find('\n'), text.size());
+
+        auto line = text.substr(0, lineEnd);
+        text.remove_prefix(std::min(lineEnd + 1, text.size()));
+
+        if (!line.empty() && line.back() == '\r')
+            line.remove_suffix(1);
+
+        if (!line.empty())
+            return line;
+    }
+
+    return {};
+}
+
+std::ofstream OpenOutput(std::string const& fileName)
+{
+    std::ofstream output {fileName, std::ios::binary};
+
+    if (!output)
+        throw std::runtime_error("Can't open '" + fileName + "'");
+
+    return output;
+}
+
+void ConvertGridsToRecords(std::string const& gridsFileName, std::string const& recordsFileName)
+{
+    MappedFile gridsFile {gridsFileName};
+    auto gridsText = gridsFile.GetContent();
+
+    auto line = TakeLine(gridsText);
+
+    if (line.empty())
+        throw std::runtime_error("No grid in '" + gridsFileName + "'");
+
+    auto output = OpenOutput(recordsFileName);
+    GridRecordsWriter writer {output, GridRecordsKind::Grids, ParseGrid(line).GetGridSize()};
+
+    for (; !line.empty(); line = TakeLine(gridsText))
+        writer.Write(ParseGrid(line));
+}
+
+void ConvertSolutionsToRecords(std::string const& gridsFileName, std::string const& solutionsFileName, std::string const& recordsFileName)
+{
+    MappedFile gridsFile {gridsFileName};
+    MappedFile solutionsFile {solutionsFileName};
+
+    auto gridsText = gridsFile.GetContent();
+    auto solutionsText = solutionsFile.GetContent();
+
+    auto gridLine = TakeLine(gridsText);
+    auto solutionLine = TakeLine(solutionsText);
+
+    if (gridLine.empty())
+        throw std::runtime_error("No grid in '" + gridsFileName + "'");
+
+    auto output = OpenOutput(recordsFileName);
+    GridRecordsWriter writer {output, GridRecordsKind::SolutionsOfGrids, ParseGrid(gridLine).GetGridSize()};
+
+    for (; !gridLine.empty(); gridLine = TakeLine(gridsText), solutionLine = TakeLine(solutionsText))
+    {
+        if (solutionLine.empty())
+            throw std::runtime_error("Fewer solutions than grids");
+
+        writer.Write(ParseGrid(gridLine), ParseGrid(solutionLine));
+    }
+}
+
+void ConvertRecordsToText(std::string const& gridsFileName, std::string const& solutionsFileName)
+{
+    MappedFile gridsFile {gridsFileName};
+    GridRecordsReader gridsReader {gridsFile.GetContent()};
+
+    std::unique_ptr<MappedFile> solutionsFile;
+    std::unique_ptr<GridRecordsReader> solutionsReader;
+
+    if (!solutionsFileName.empty())
+    {
+        solutionsFile = std::make_unique<MappedFile>(solutionsFileName);
+        solutionsReader = std::make_unique<GridRecordsReader>(solutionsFile->GetContent());
+    }
+
+    std::string lines;
+
+    while (!gridsReader.IsOver())
+    {
+        auto grid = gridsReader.Read();
+
+        if (solutionsReader)
+            grid = solutionsReader->Read(grid);
+
+        const auto linesSize = lines.size();
+        lines.resize(linesSize + grid.GetCellsCount());
+        FormatGrid(grid, lines.data() + linesSize);
+        lines += '\n';
+
+        if (lines.size() >= 64 * 1024)
+        {
+            std::cout.write(lines.data(), lines.size());
+            lines.clear();
+        }
+    }
+
+    std::cout.write(lines.data(), lines.size());
+    std::cout.flush();
+}
+
+int main(int argc, char* argv[])
+{
+    std::ios::sync_with_stdio(false);
+
+    const std::string command {argc > 1 ? argv[1] : ""};
+
+    try
+    {
+        if (command == "to-records" && argc == 4)
+            ConvertGridsToRecords(argv[2], argv[3]);
+        else if (command == "solutions-to-records" && argc == 5)
+            ConvertSolutionsToRecords(argv[2], argv[3], argv[4]);
+        else if (command == "to-text" && (argc == 3 || argc == 4))
+            ConvertRecordsToText(argv[2], argc == 4 ? argv[3] : "");
+        else
+        {
+            PrintUsage();
+            return 1;
+        }
+    }
+    catch (std::runtime_error const& e)
+    {
+        std::cerr << e.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,128 @@
+#include <algorithm>
+#include <cstdint>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+
+#include "GridSolverFactory.hpp"
+#include "GridText.hpp"
+
+using namespace sudoku;
+
+// Writes grids with a unique solution on the standard output, one grid per line (see ParseGrid).
+// The grids only depend on the options and the seed, not on the number of threads.
+
+void PrintUsage()
+{
+    std::cerr << "Usage: sudoku_grid_generator [-n grids] [-g grid size] [-c clues] [-s none|central|diagonal] [-r seed] [-t threads]" << std::endl
+              << "Generates 1 grid of size 9 with at most 26 clues by default." << std::endl;
+}
+
+Symmetry ParseSymmetry(std::string const& name)
+{
+    if (name == "none")
+        return Symmetry::None;
+
+    if (name == "central")
+        return Symmetry::Central;
+
+    if (name == "diagonal")
+        return Symmetry::Diagonal;
+
+    throw std::runtime_error("Unknown symmetry '" + name + "'");
+}
+
+int main(int argc, char* argv[])
+{
+    std::ios::sync_with_stdio(false);
+
+    // Grids generated and written at once
+    constexpr int GridsPerBatch {1'024};
+
+    PuzzleGeneration puzzleGeneration;
+    int gridsCount {1};
+    std::uint64_t seed {0};
+    int threadsCount {0};
+
+    try
+    {
+        for (int i = 1; i < argc; i++)
+        {
+            const std::string arg {argv[i]};
+            const bool hasValue = i + 1 < argc;
+
+            if (arg == "-h" || arg == "--help")
+            {
+                PrintUsage();
+                return 0;
+            }
+            else if (arg == "-n" && hasValue)
+            {
+                gridsCount = std::stoi(argv[++i]);
+            }
+            else if (arg == "-g" && hasValue)
+            {
+                puzzleGeneration.m_GridSize = std::stoi(argv[++i]);
+            }
+            else if (arg == "-c" && hasValue)
+            {
+                puzzleGeneration.m_CluesCount = std::stoi(argv[++i]);
+            }
+            else if (arg == "-s" && hasValue)
+            {
+                puzzleGeneration.m_Symmetry = ParseSymmetry(argv[++i]);
+            }
+            else if (arg == "-r" && hasValue)
+            {
+                seed = std::stoull(argv[++i]);
+            }
+            else if (arg == "-t" && hasValue)
+            {
+                threadsCount = std::stoi(argv[++i]);
+            }
+            else
+            {
+                PrintUsage();
+                return 1;
+            }
+        }
+
+        auto gridGenerator = GridSolverFactory::MakeGenerator(puzzleGeneration, threadsCount);
+
+        int generatedCount {0};
+        std::string lines;
+
+        for (int first = 0; first < gridsCount; first += GridsPerBatch)
+        {
+            const auto grids = gridGenerator->Generate(std::min(GridsPerBatch, gridsCount - first), seed + first);
+
+            lines.clear();
+
+            for (auto const& grid : grids)
+            {
+                const auto linesSize = lines.size();
+                lines.resize(linesSize + grid.GetCellsCount());
+                FormatGrid(grid, lines.data() + linesSize);
+                lines += '\n';
+            }
+
+            std::cout.write(lines.data(), lines.size());
+            generatedCount += grids.size();
+        }
+
+        std::cout.flush();
+
+        if (generatedCount < gridsCount)
+        {
+            std::cerr << gridsCount - generatedCount << " grids left out, their solutions needed more clues" << std::endl;
+            return 2;
+        }
+    }
+    catch (std::exception const& e)
+    {
+        std::cerr << e.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
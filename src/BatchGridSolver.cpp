@@ -0,0 +1,241 @@
+#include "BatchGridSolver.hpp"
+
+#include "GridUnits.hpp"
+#include "Lanes.hpp"
+
+namespace sudoku
+{
+namespace detail
+{
+
+namespace
+{
+
+using Lanes = VectorLanes;
+
+static_assert(BatchWidth % Lanes::Width == 0, "Batch must be made of whole vectors");
+
+PossibilitiesBitSet GetPackedPossibilities(int gridSize, std::uint8_t value)
+{
+    if (value == 0)
+        return Possibilities {gridSize}.GetBitSet();
+
+    return value <= gridSize ? Possibilities::ValueBit(value) : 0;
+}
+
+// Possibilities of a cell in every grid of the batch, interleaved so that a vector holds several grids
+using BatchBitSets = std::array<PossibilitiesBitSet, BatchWidth>;
+
+class LockstepPropagation
+{
+public:
+    // The lanes of the cells are allocated for the largest grid size loaded so far
+    void Load(int gridSize, std::uint8_t const* values, int count);
+
+    void Run()
+    {
+        while (PropagateInUnits())
+        {}
+    }
+
+    LockstepResult GetResult(int lane) const;
+
+    // The grid must be solved
+    void StoreValues(int lane, std::uint8_t* values) const;
+
+    void GetPossibilities(int lane, Grid& grid) const;
+
+private:
+    bool PropagateInUnits();
+
+    PossibilitiesBitSet* GetCellLanes(int unit, int slot, int lane) { return &m_Cells[m_Units->GetCellIndex(unit, slot)][lane]; }
+
+    int m_GridSize {0};
+    GridUnits const* m_Units {nullptr};
+    PossibilitiesBitSet m_AllValues {};
+
+    std::vector<BatchBitSets> m_Cells;
+};
+
+LockstepPropagation& GetLockstepPropagation()
+{
+    thread_local LockstepPropagation propagation;
+    return propagation;
+}
+
+void LockstepPropagation::Load(int gridSize, std::uint8_t const* values, int count)
+{
+    const auto cellsCount = gridSize * gridSize;
+
+    m_GridSize = gridSize;
+    m_Units = &GridUnits::Get(gridSize);
+    m_AllValues = Possibilities {gridSize}.GetBitSet();
+
+    if (static_cast<int>(m_Cells.size()) < cellsCount)
+        m_Cells.resize(cellsCount);
+
+    for (int index = 0; index < cellsCount; index++)
+    {
+        // Lanes without a grid repeat the first one, their result is ignored
+        for (int lane = 0; lane < BatchWidth; lane++)
+        {
+            m_Cells[index][lane] = GetPackedPossibilities(gridSize, values[(lane < count ? lane : 0) * cellsCount + index]);
+        }
+    }
+}
+
+// For each unit: the values set in a cell are removed from the other cells, a value set in two cells
+// empties both of them, then the values left in a single cell are set there.
+// Returns whether a possibility was removed in any grid.
+bool LockstepPropagation::PropagateInUnits()
+{
+    auto removed = Lanes::Zero();
+
+    Lanes::Type cells[MaxGridSize];
+    Lanes::Type cellsSetValue[MaxGridSize];
+
+    for (int unit = 0; unit < m_Units->GetUnitsCount(); unit++)
+    {
+        for (int lane = 0; lane < BatchWidth; lane += Lanes::Width)
+        {
+            auto setValues = Lanes::Zero();
+            auto duplicatedSetValues = Lanes::Zero();
+
+            for (int slot = 0; slot < m_GridSize; slot++)
+            {
+                cells[slot] = Lanes::Load(GetCellLanes(unit, slot, lane));
+                cellsSetValue[slot] = Lanes::SetValues(cells[slot]);
+
+                duplicatedSetValues = Lanes::Or(duplicatedSetValues, Lanes::And(setValues, cellsSetValue[slot]));
+                setValues = Lanes::Or(setValues, cellsSetValue[slot]);
+            }
+
+            auto seenOnce = Lanes::Zero();
+            auto seenTwice = Lanes::Zero();
+
+            for (int slot = 0; slot < m_GridSize; slot++)
+            {
+                const auto otherCellsSetValues = Lanes::Or(
+                            Lanes::AndNot(setValues, cellsSetValue[slot]),
+                            Lanes::And(duplicatedSetValues, cellsSetValue[slot]));
+
+                cells[slot] = Lanes::AndNot(cells[slot], otherCellsSetValues);
+
+                seenTwice = Lanes::Or(seenTwice, Lanes::And(seenOnce, cells[slot]));
+                seenOnce = Lanes::Or(seenOnce, cells[slot]);
+            }
+
+            const auto uniquePossibilities = Lanes::AndNot(seenOnce, seenTwice);
+
+            for (int slot = 0; slot < m_GridSize; slot++)
+            {
+                auto* cellLanes = GetCellLanes(unit, slot, lane);
+
+                const auto uniquePossibility = Lanes::And(cells[slot], uniquePossibilities);
+                const auto updated = Lanes::Select(Lanes::IsZero(uniquePossibility), cells[slot], uniquePossibility);
+
+                removed = Lanes::Or(removed, Lanes::AndNot(Lanes::Load(cellLanes), updated));
+                Lanes::Store(cellLanes, updated);
+            }
+        }
+    }
+
+    return Lanes::AnyNonZero(removed);
+}
+
+LockstepResult LockstepPropagation::GetResult(int lane) const
+{
+    bool allCellsSet = true;
+
+    for (int index = 0; index < m_GridSize * m_GridSize; index++)
+    {
+        const auto possibilities = Possibilities {m_Cells[index][lane]};
+
+        if (possibilities.GetBitSet() == 0)
+            return LockstepResult::Wrong;
+
+        allCellsSet &= possibilities.OnlyOnePossibilityLeft();
+    }
+
+    // A value with no cell left in a unit can't be placed
+    for (int unit = 0; unit < m_Units->GetUnitsCount(); unit++)
+    {
+        PossibilitiesBitSet unitPossibilities {};
+
+        for (int slot = 0; slot < m_GridSize; slot++)
+            unitPossibilities |= m_Cells[m_Units->GetCellIndex(unit, slot)][lane];
+
+        if (unitPossibilities != m_AllValues)
+            return LockstepResult::Wrong;
+    }
+
+    return allCellsSet ? LockstepResult::Solved : LockstepResult::NeedsHypothesis;
+}
+
+void LockstepPropagation::StoreValues(int lane, std::uint8_t* values) const
+{
+    for (int index = 0; index < m_GridSize * m_GridSize; index++)
+        values[index] = Possibilities {m_Cells[index][lane]}.GetLowestPossibilityLeft();
+}
+
+void LockstepPropagation::GetPossibilities(int lane, Grid& grid) const
+{
+    std::array<Possibilities, MaxGridSize * MaxGridSize> possibilities;
+
+    for (int index = 0; index < m_GridSize * m_GridSize; index++)
+        possibilities[index] = m_Cells[index][lane];
+
+    grid.SetAllPossibilities(possibilities.data());
+}
+
+} // anonymous namespace
+
+void PropagateInLockstep(int gridSize, std::uint8_t* values, int count, LockstepResult* results)
+{
+    auto& propagation = GetLockstepPropagation();
+
+    propagation.Load(gridSize, values, count);
+    propagation.Run();
+
+    const auto cellsCount = gridSize * gridSize;
+
+    for (int lane = 0; lane < count; lane++)
+    {
+        results[lane] = propagation.GetResult(lane);
+
+        if (results[lane] == LockstepResult::Solved)
+            propagation.StoreValues(lane, values + lane * cellsCount);
+    }
+}
+
+void GetLockstepPossibilities(int lane, Grid& grid)
+{
+    GetLockstepPropagation().GetPossibilities(lane, grid);
+}
+
+} // namespace detail
+
+void PackValues(Grid const& grid, std::uint8_t* values)
+{
+    for (int index = 0; index < grid.GetCellsCount(); index++)
+    {
+        auto const& possibilities = grid.GetPossibilities(index);
+        values[index] = possibilities.OnlyOnePossibilityLeft() ? possibilities.GetLowestPossibilityLeft() : 0;
+    }
+}
+
+Grid UnpackValues(int gridSize, std::uint8_t const* values)
+{
+    Grid grid {gridSize};
+
+    std::array<Possibilities, MaxGridSize * MaxGridSize> possibilities;
+
+    for (int index = 0; index < grid.GetCellsCount(); index++)
+        possibilities[index] = detail::GetPackedPossibilities(gridSize, values[index]);
+
+    grid.SetAllPossibilities(possibilities.data());
+
+    return grid;
+}
+
+} // namespace sudoku
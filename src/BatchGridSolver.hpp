@@ -0,0 +1,113 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "GridSolverWithHypothesis.hpp"
+#include "GridSize.hpp"
+#include "Grid.hpp"
+
+namespace sudoku
+{
+
+class BatchGridSolver
+{
+public:
+    virtual ~BatchGridSolver() = default;
+
+    // Solves in place the count grids of size gridSize packed from values, see PackValues: 81 bytes per 9x9 grid.
+    // The grids solved have all their cells filled, the others are left as they were.
+    // Returns for each grid whether it was solved. Throws if the grid size isn't supported.
+    virtual std::vector<bool> Solve(int gridSize, std::uint8_t* values, std::size_t count) const = 0;
+};
+
+// One byte per cell in index order, the value of the cell or 0 if it isn't set.
+// A value above the grid size leaves its cell without possibility.
+void PackValues(Grid const& grid, std::uint8_t* values);
+Grid UnpackValues(int gridSize, std::uint8_t const* values);
+
+// Propagates BatchWidth grids at once, one grid per vector lane.
+// The grids that propagation alone can't solve are handed to the grid solver.
+template<typename TGridSolver = GridSolver>
+class BatchGridSolverImpl final : public BatchGridSolver
+{
+public:
+    BatchGridSolverImpl(std::unique_ptr<TGridSolver> gridSolver);
+
+    std::vector<bool> Solve(int gridSize, std::uint8_t* values, std::size_t count) const override;
+
+private:
+    std::unique_ptr<TGridSolver> m_GridSolver;
+};
+
+namespace detail
+{
+
+constexpr int BatchWidth {16};
+
+enum class LockstepResult
+{
+    Solved,
+    Wrong,
+    NeedsHypothesis
+};
+
+// Removes the set values from their units and sets the unique possibilities of the units,
+// in up to BatchWidth packed grids until none of them changes. The values of the grids solved are written back.
+// The lanes are kept by each thread from one batch to the next.
+void PropagateInLockstep(int gridSize, std::uint8_t* values, int count, LockstepResult* results);
+
+// Possibilities left in a grid by the last PropagateInLockstep of the calling thread
+void GetLockstepPossibilities(int lane, Grid& grid);
+
+} // namespace detail
+
+template<typename TGridSolver>
+BatchGridSolverImpl<TGridSolver>::BatchGridSolverImpl(std::unique_ptr<TGridSolver> gridSolver) :
+    m_GridSolver(std::move(gridSolver))
+{}
+
+template<typename TGridSolver>
+std::vector<bool> BatchGridSolverImpl<TGridSolver>::Solve(int gridSize, std::uint8_t* values, std::size_t count) const
+{
+    // Throws if the size isn't supported
+    VisitGridSize(gridSize, [](auto){});
+
+    const std::size_t cellsCount = gridSize * gridSize;
+
+    std::vector<bool> solved(count);
+    std::array<detail::LockstepResult, detail::BatchWidth> results;
+
+    for (std::size_t first = 0; first < count; first += detail::BatchWidth)
+    {
+        const auto batchCount = std::min<std::size_t>(detail::BatchWidth, count - first);
+        auto* batchValues = values + first * cellsCount;
+
+        detail::PropagateInLockstep(gridSize, batchValues, batchCount, results.data());
+
+        for (std::size_t lane = 0; lane < batchCount; lane++)
+        {
+            if (results[lane] == detail::LockstepResult::NeedsHypothesis)
+            {
+                Grid grid {gridSize};
+                detail::GetLockstepPossibilities(lane, grid);
+
+                if (m_GridSolver->Solve(grid))
+                {
+                    PackValues(grid, batchValues + lane * cellsCount);
+                    solved[first + lane] = true;
+                }
+            }
+            else
+                solved[first + lane] = results[lane] == detail::LockstepResult::Solved;
+        }
+    }
+
+    return solved;
+}
+
+} /* namespace sudoku */
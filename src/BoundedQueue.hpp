@@ -0,0 +1,84 @@
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <optional>
+
+namespace sudoku
+{
+
+// Queue shared between threads, pushing waits while it holds capacity items and popping waits while it is empty.
+// Once closed, pushing does nothing and popping returns nullopt as soon as it is empty.
+template<typename T>
+class BoundedQueue
+{
+public:
+    BoundedQueue(std::size_t capacity) : m_Capacity(capacity) {}
+
+    void Push(T item);
+
+    std::optional<T> Pop();
+
+    void Close();
+
+private:
+    const std::size_t m_Capacity;
+
+    std::mutex m_Mutex;
+    std::condition_variable m_NotFull;
+    std::condition_variable m_NotEmpty;
+    std::deque<T> m_Items;
+    bool m_Closed {false};
+};
+
+template<typename T>
+void BoundedQueue<T>::Push(T item)
+{
+    {
+        std::unique_lock<std::mutex> lock(m_Mutex);
+        m_NotFull.wait(lock, [this]{ return m_Items.size() < m_Capacity || m_Closed; });
+
+        if (m_Closed)
+            return;
+
+        m_Items.push_back(std::move(item));
+    }
+
+    m_NotEmpty.notify_one();
+}
+
+template<typename T>
+std::optional<T> BoundedQueue<T>::Pop()
+{
+    std::optional<T> item;
+
+    {
+        std::unique_lock<std::mutex> lock(m_Mutex);
+        m_NotEmpty.wait(lock, [this]{ return !m_Items.empty() || m_Closed; });
+
+        if (m_Items.empty())
+            return std::nullopt;
+
+        item = std::move(m_Items.front());
+        m_Items.pop_front();
+    }
+
+    m_NotFull.notify_one();
+
+    return item;
+}
+
+template<typename T>
+void BoundedQueue<T>::Close()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        m_Closed = true;
+    }
+
+    m_NotFull.notify_all();
+    m_NotEmpty.notify_all();
+}
+
+} // namespace sudoku
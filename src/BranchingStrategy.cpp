@@ -0,0 +1,181 @@
+#include "BranchingStrategy.hpp"
+
+#include <limits>
+#include <stdexcept>
+
+namespace sudoku
+{
+
+namespace
+{
+
+int SelectCellWithFewestPossibilities(Grid const& grid)
+{
+    const auto index = grid.GetCellWithFewestPossibilities();
+
+    if (index < 0)
+        throw std::runtime_error("Can't find best position for hyposesis in completed grid.");
+
+    return index;
+}
+
+Branch MakeCellBranch(Grid const& grid, int index)
+{
+    return {Branch::Kind::CellValues, grid.GetPosition(index), -1, 0};
+}
+
+// Highest value of the cell, or first cell of the unit
+Hypothesis SelectFirstHypothesis(Grid const& grid, Branch const& branch)
+{
+    if (branch.m_Kind == Branch::Kind::CellValues)
+        return {branch.m_Position, grid.GetPossibilities(grid.GetIndex(branch.m_Position)).GetPossibilityLeft()};
+
+    const auto slots = grid.GetValueLocations(branch.m_Unit, branch.m_Value);
+
+    return {grid.GetPosition(grid.GetUnits().GetCellIndex(branch.m_Unit, __builtin_ctz(slots))), branch.m_Value};
+}
+
+// Cells of the units of the cell, the cell included, where the value is possible
+int CountCellsConstrained(Grid const& grid, int index, Value value)
+{
+    int count {0};
+
+    for (auto const& [unit, slot] : grid.GetUnits().GetCellSlots(index))
+        count += __builtin_popcount(grid.GetValueLocations(unit, value));
+
+    return count;
+}
+
+int CountCellsLeftInUnits(Grid const& grid, int index)
+{
+    int count {0};
+
+    for (auto const& [unit, slot] : grid.GetUnits().GetCellSlots(index))
+        count += grid.GetGridSize() - __builtin_popcount(grid.GetPlacedValues(unit));
+
+    return count;
+}
+
+} // anonymous namespace
+
+Branch FewestPossibilitiesBranchingImpl::SelectBranch(Grid const& grid) const
+{
+    return MakeCellBranch(grid, SelectCellWithFewestPossibilities(grid));
+}
+
+Hypothesis FewestPossibilitiesBranchingImpl::SelectHypothesis(Grid const& grid, Branch const& branch) const
+{
+    return SelectFirstHypothesis(grid, branch);
+}
+
+Branch LeastConstrainingValueBranchingImpl::SelectBranch(Grid const& grid) const
+{
+    return MakeCellBranch(grid, SelectCellWithFewestPossibilities(grid));
+}
+
+Hypothesis LeastConstrainingValueBranchingImpl::SelectHypothesis(Grid const& grid, Branch const& branch) const
+{
+    const auto index = grid.GetIndex(branch.m_Position);
+
+    Value bestValue {0};
+    int fewestCellsConstrained {std::numeric_limits<int>::max()};
+
+    // From the highest value, so that ties are broken as with FewestPossibilitiesBranchingImpl
+    for (auto values = grid.GetPossibilities(index).GetBitSet(); values != 0;)
+    {
+        const Value value = 32 - __builtin_clz(values);
+        values &= ~Possibilities::ValueBit(value);
+
+        const auto cellsConstrained = CountCellsConstrained(grid, index, value);
+
+        if (cellsConstrained < fewestCellsConstrained)
+        {
+            fewestCellsConstrained = cellsConstrained;
+            bestValue = value;
+        }
+    }
+
+    return {branch.m_Position, bestValue};
+}
+
+Branch MostConstrainedUnitsBranchingImpl::SelectBranch(Grid const& grid) const
+{
+    const auto firstIndex = SelectCellWithFewestPossibilities(grid);
+    const auto* cells = grid.GetCellsWithPossibilitiesCount(grid.GetPossibilities(firstIndex).Count());
+
+    int bestIndex {firstIndex};
+    int mostCellsLeft {-1};
+
+    for (int word = 0; word < grid.GetCellsWordsCount(); word++)
+    {
+        for (auto cellBits = cells[word]; cellBits != 0; cellBits &= cellBits - 1)
+        {
+            const auto index = word * 64 + __builtin_ctzll(cellBits);
+            const auto cellsLeft = CountCellsLeftInUnits(grid, index);
+
+            if (cellsLeft > mostCellsLeft)
+            {
+                mostCellsLeft = cellsLeft;
+                bestIndex = index;
+            }
+        }
+    }
+
+    return MakeCellBranch(grid, bestIndex);
+}
+
+Hypothesis MostConstrainedUnitsBranchingImpl::SelectHypothesis(Grid const& grid, Branch const& branch) const
+{
+    return SelectFirstHypothesis(grid, branch);
+}
+
+Branch UnitCellsBranchingImpl::SelectBranch(Grid const& grid) const
+{
+    const auto cellIndex = SelectCellWithFewestPossibilities(grid);
+    const auto cellPossibilitiesCount = grid.GetPossibilities(cellIndex).Count();
+
+    // A value can't have fewer than two cells left in a unit once the unique possibilities are set
+    if (cellPossibilitiesCount <= 2)
+        return MakeCellBranch(grid, cellIndex);
+
+    const auto allValues = (PossibilitiesBitSet{1} << grid.GetGridSize()) - 1;
+
+    Branch bestBranch {MakeCellBranch(grid, cellIndex)};
+    int fewestHypotheses {cellPossibilitiesCount};
+
+    for (int unit = 0; unit < grid.GetUnits().GetUnitsCount() && fewestHypotheses > 2; unit++)
+    {
+        for (auto values = allValues & ~grid.GetPlacedValues(unit); values != 0; values &= values - 1)
+        {
+            const Value value = __builtin_ctz(values) + 1;
+            const auto cellsCount = __builtin_popcount(grid.GetValueLocations(unit, value));
+
+            if (cellsCount >= 2 && cellsCount < fewestHypotheses)
+            {
+                fewestHypotheses = cellsCount;
+                bestBranch = {Branch::Kind::UnitCells, {}, unit, value};
+            }
+        }
+    }
+
+    return bestBranch;
+}
+
+Hypothesis UnitCellsBranchingImpl::SelectHypothesis(Grid const& grid, Branch const& branch) const
+{
+    return SelectFirstHypothesis(grid, branch);
+}
+
+namespace detail
+{
+
+int CountHypothesesLeft(Grid const& grid, Branch const& branch)
+{
+    if (branch.m_Kind == Branch::Kind::CellValues)
+        return grid.GetPossibilities(grid.GetIndex(branch.m_Position)).Count();
+
+    return __builtin_popcount(grid.GetValueLocations(branch.m_Unit, branch.m_Value));
+}
+
+} // namespace detail
+} // namespace sudoku
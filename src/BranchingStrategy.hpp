@@ -0,0 +1,94 @@
+#pragma once
+
+#include "Grid.hpp"
+#include "Position.hpp"
+#include "Value.hpp"
+
+namespace sudoku
+{
+
+// Hypotheses of which one has to be right if the grid can be solved:
+// the values left in a cell, or the cells of a unit where a value can still go
+struct Branch
+{
+    enum class Kind
+    {
+        CellValues,
+        UnitCells
+    };
+
+    Kind m_Kind;
+
+    // For CellValues
+    Position m_Position;
+
+    // For UnitCells
+    int m_Unit;
+    Value m_Value;
+};
+
+struct Hypothesis
+{
+    Position m_Position;
+    Value m_Value;
+};
+
+class BranchingStrategy
+{
+public:
+    virtual ~BranchingStrategy() = default;
+
+    // The grid must have cells left to set
+    virtual Branch SelectBranch(Grid const& grid) const = 0;
+
+    // One of the hypotheses of the branch still possible in the grid, the ones which failed have been removed from it
+    virtual Hypothesis SelectHypothesis(Grid const& grid, Branch const& branch) const = 0;
+};
+
+enum class Branching
+{
+    // Cell with the fewest possibilities left, the first one in the grid on ties, its highest value first
+    FewestPossibilities,
+    // Same cell, the value possible in the fewest other cells of its units first
+    LeastConstrainingValue,
+    // Cell with the fewest possibilities left, the one with the most cells left to set in its units on ties
+    MostConstrainedUnits,
+    // Cells of a unit where a value can go, when there are fewer of them than possibilities in any cell
+    UnitCells
+};
+
+class FewestPossibilitiesBranchingImpl final : public BranchingStrategy
+{
+public:
+    Branch SelectBranch(Grid const& grid) const override;
+    Hypothesis SelectHypothesis(Grid const& grid, Branch const& branch) const override;
+};
+
+class LeastConstrainingValueBranchingImpl final : public BranchingStrategy
+{
+public:
+    Branch SelectBranch(Grid const& grid) const override;
+    Hypothesis SelectHypothesis(Grid const& grid, Branch const& branch) const override;
+};
+
+class MostConstrainedUnitsBranchingImpl final : public BranchingStrategy
+{
+public:
+    Branch SelectBranch(Grid const& grid) const override;
+    Hypothesis SelectHypothesis(Grid const& grid, Branch const& branch) const override;
+};
+
+class UnitCellsBranchingImpl final : public BranchingStrategy
+{
+public:
+    Branch SelectBranch(Grid const& grid) const override;
+    Hypothesis SelectHypothesis(Grid const& grid, Branch const& branch) const override;
+};
+
+namespace detail
+{
+// Hypotheses of the branch still possible in the grid
+int CountHypothesesLeft(Grid const& grid, Branch const& branch);
+} // namespace detail
+
+} /* namespace sudoku */
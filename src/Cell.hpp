@@ -1,6 +1,8 @@
 #pragma once
 
-#include <memory>
+#include <iterator>
+#include <optional>
+#include <type_traits>
 
 #include "Position.hpp"
 #include "Possibilities.hpp"
@@ -8,32 +10,70 @@
 namespace sudoku
 {
 
-class Cell
+class Grid;
+
+// View on the cell stored at an index of a grid
+template<typename TGrid>
+class CellView
 {
 public:
-    Cell(Position position, int gridSize);
-    Cell(Cell const& cell);
+    CellView(TGrid& grid, int index) : m_Grid(&grid), m_Index(index) {}
 
-    Cell& operator=(Cell const& cell);
+    // A cell of a mutable grid can be viewed as a read only cell
+    template<typename TOtherGrid, typename = std::enable_if_t<std::is_convertible_v<TOtherGrid*, TGrid*>>>
+    CellView(CellView<TOtherGrid> const& cell) : m_Grid(&cell.GetGrid()), m_Index(cell.GetIndex()) {}
 
-    void RemovePossibility(Value const& value);
+    // Returns false if the cell has no possibility left
+    bool RemovePossibility(Value const& value) const { return m_Grid->RemovePossibility(m_Index, value); }
 
-    void SetValue(Value const& value);
-    std::optional<Value> GetValue() const;
+    void SetValue(Value const& value) const { m_Grid->SetValue(m_Index, value); }
+    std::optional<Value> GetValue() const { return GetPossibilities().GetValue(); }
 
-    bool IsSet() const;
-    Possibilities const& GetPossibilities() const;
-    int GetNumberPossibilitiesLeft() const;
+    bool IsSet() const { return GetPossibilities().OnlyOnePossibilityLeft(); }
+    Possibilities const& GetPossibilities() const { return m_Grid->GetPossibilities(m_Index); }
+    int GetNumberPossibilitiesLeft() const { return GetPossibilities().Count(); }
 
-    Position const& GetPosition() const;
+    Position GetPosition() const { return m_Grid->GetPosition(m_Index); }
+    int GetIndex() const { return m_Index; }
+    TGrid& GetGrid() const { return *m_Grid; }
 
-    bool operator==(Cell const& cell) const;
+    bool operator==(CellView const& cell) const
+    {
+        return GetPossibilities() == cell.GetPossibilities()
+                && GetPosition() == cell.GetPosition();
+    }
 
 private:
-    Possibilities m_Possibilities;
-    const Position m_Position;
+    TGrid* m_Grid;
+    int m_Index;
 };
 
-using SharedCell = std::shared_ptr<Cell>;
+using Cell = CellView<Grid>;
+using ConstCell = CellView<Grid const>;
+
+template<typename TGrid>
+class CellIterator
+{
+public:
+    using iterator_category = std::input_iterator_tag;
+    using value_type = CellView<TGrid>;
+    using difference_type = int;
+    using pointer = void;
+    using reference = CellView<TGrid>;
+
+    CellIterator(TGrid& grid, int index) : m_Grid(&grid), m_Index(index) {}
+
+    CellView<TGrid> operator*() const { return {*m_Grid, m_Index}; }
+
+    CellIterator& operator++() { m_Index++; return *this; }
+    CellIterator operator++(int) { auto previous = *this; m_Index++; return previous; }
+
+    bool operator==(CellIterator const& other) const { return m_Index == other.m_Index; }
+    bool operator!=(CellIterator const& other) const { return m_Index != other.m_Index; }
+
+private:
+    TGrid* m_Grid;
+    int m_Index;
+};
 
 } // namespace sudoku
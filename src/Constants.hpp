@@ -1 +1,10 @@
-#define MaxGridSize 9 /* should be inline constexpr with later compiler */
+#pragma once
+
+namespace sudoku
+{
+
+inline constexpr int MaxGridSize {25};
+
+inline constexpr int CacheLineSize {64};
+
+} // namespace sudoku
@@ -0,0 +1,397 @@
+#include "DancingLinksGridSolver.hpp"
+
+#include <array>
+#include <vector>
+
+#include "Grid.hpp"
+#include "GridSize.hpp"
+
+namespace sudoku
+{
+
+namespace
+{
+
+// The choices of the exact cover are the values of the cells, choice cell * gridSize + value - 1.
+// Each of them is a row of four nodes, one in each constraint it satisfies.
+template<int TGridSize>
+class DancingLinks
+{
+public:
+    DancingLinks();
+
+    // The links are restored before returning
+    bool Solve(Grid& grid);
+
+private:
+    static constexpr int CellsCount {GetCellsNumberInGrid(TGridSize)};
+    static constexpr int ChoicesCount {CellsCount * TGridSize};
+    static constexpr int NodesPerChoice {4};
+
+    // The columns: one per cell, then one per value of each row, of each column and of each block
+    static constexpr int ConstraintsCount {NodesPerChoice * CellsCount};
+
+    static constexpr int Root {0};
+    static constexpr int FirstChoiceNode {ConstraintsCount + 1};
+
+    struct Node
+    {
+        int m_Left;
+        int m_Right;
+        int m_Up;
+        int m_Down;
+        int m_Column;
+    };
+
+    struct Restriction
+    {
+        // Otherwise the choice has been removed
+        bool m_Selected;
+        int m_Choice;
+    };
+
+    static int GetChoice(int node) { return (node - FirstChoiceNode) / NodesPerChoice; }
+    static int GetFirstNode(int choice) { return FirstChoiceNode + choice * NodesPerChoice; }
+
+    static std::array<int, NodesPerChoice> GetColumns(int choice);
+
+    // Removes the choices which aren't possibilities of the grid and selects the cells already set.
+    // False if a cell has no possibility left or two set cells conflict.
+    bool Restrict(Grid const& grid);
+    void RestoreRestrictions();
+
+    bool Search();
+
+    // Column with the fewest choices left, the root if all the columns are covered
+    int SelectColumn() const;
+
+    void Cover(int column);
+    void Uncover(int column);
+
+    bool IsCovered(int column) const { return m_Nodes[m_Nodes[column].m_Left].m_Right != column; }
+
+    void RemoveChoice(int choice);
+    void RestoreChoice(int choice);
+
+    // False, and nothing changed, if one of the constraints of the choice is already covered
+    bool SelectChoice(int choice);
+    void UnselectChoice(int choice);
+
+    void Store(Grid& grid) const;
+
+    std::vector<Node> m_Nodes;
+    std::vector<int> m_ColumnSizes;
+
+    std::vector<Restriction> m_Restrictions;
+    std::vector<int> m_Solution;
+};
+
+template<int TGridSize>
+DancingLinks<TGridSize>::DancingLinks() :
+    m_Nodes(FirstChoiceNode + ChoicesCount * NodesPerChoice),
+    m_ColumnSizes(ConstraintsCount + 1)
+{
+    for (int column = Root; column <= ConstraintsCount; column++)
+        m_Nodes[column] = {column == Root ? ConstraintsCount : column - 1, column == ConstraintsCount ? Root : column + 1, column, column, column};
+
+    for (int choice = 0; choice < ChoicesCount; choice++)
+    {
+        const auto columns = GetColumns(choice);
+        const auto firstNode = GetFirstNode(choice);
+
+        for (int i = 0; i < NodesPerChoice; i++)
+        {
+            const auto node = firstNode + i;
+            const auto column = columns[i];
+            const auto lastNode = m_Nodes[column].m_Up;
+
+            m_Nodes[node] = {
+                    firstNode + (i + NodesPerChoice - 1) % NodesPerChoice,
+                    firstNode + (i + 1) % NodesPerChoice,
+                    lastNode,
+                    column,
+                    column};
+
+            m_Nodes[lastNode].m_Down = node;
+            m_Nodes[column].m_Up = node;
+            m_ColumnSizes[column]++;
+        }
+    }
+
+    m_Restrictions.reserve(ChoicesCount);
+    m_Solution.reserve(CellsCount);
+}
+
+template<int TGridSize>
+std::array<int, DancingLinks<TGridSize>::NodesPerChoice> DancingLinks<TGridSize>::GetColumns(int choice)
+{
+    constexpr int blockRows {GetBlockRows(TGridSize)};
+    constexpr int blockCols {GetBlockCols(TGridSize)};
+
+    const auto cell = choice / TGridSize;
+    const auto value = choice % TGridSize;
+    const auto row = cell / TGridSize;
+    const auto col = cell % TGridSize;
+    const auto block = (row / blockRows) * (TGridSize / blockCols) + col / blockCols;
+
+    return {
+        1 + cell,
+        1 + CellsCount + row * TGridSize + value,
+        1 + 2 * CellsCount + col * TGridSize + value,
+        1 + 3 * CellsCount + block * TGridSize + value};
+}
+
+template<int TGridSize>
+bool DancingLinks<TGridSize>::Solve(Grid& grid)
+{
+    m_Solution.clear();
+
+    const auto solved = Restrict(grid) && Search();
+
+    // Before the grid is written, so that the links of the thread are left whole if writing it throws
+    RestoreRestrictions();
+
+    if (solved)
+        Store(grid);
+
+    return solved;
+}
+
+template<int TGridSize>
+bool DancingLinks<TGridSize>::Restrict(Grid const& grid)
+{
+    m_Restrictions.clear();
+
+    for (int cell = 0; cell < CellsCount; cell++)
+    {
+        const auto bitSet = grid.GetPossibilities(cell).GetBitSet();
+
+        if (bitSet == 0)
+            return false;
+
+        for (int value = 0; value < TGridSize; value++)
+        {
+            if ((bitSet & (PossibilitiesBitSet{1} << value)) != 0)
+                continue;
+
+            RemoveChoice(cell * TGridSize + value);
+            m_Restrictions.push_back({false, cell * TGridSize + value});
+        }
+    }
+
+    for (int cell = 0; cell < CellsCount; cell++)
+    {
+        const auto possibilities = grid.GetPossibilities(cell);
+
+        if (!possibilities.OnlyOnePossibilityLeft())
+            continue;
+
+        const auto choice = cell * TGridSize + possibilities.GetLowestPossibilityLeft() - 1;
+
+        if (!SelectChoice(choice))
+            return false;
+
+        m_Restrictions.push_back({true, choice});
+    }
+
+    return true;
+}
+
+template<int TGridSize>
+void DancingLinks<TGridSize>::RestoreRestrictions()
+{
+    for (auto restriction = m_Restrictions.rbegin(); restriction != m_Restrictions.rend(); restriction++)
+    {
+        if (restriction->m_Selected)
+            UnselectChoice(restriction->m_Choice);
+        else
+            RestoreChoice(restriction->m_Choice);
+    }
+
+    m_Restrictions.clear();
+}
+
+// The links are restored on the way back, the choices of the solution are left in m_Solution
+template<int TGridSize>
+bool DancingLinks<TGridSize>::Search()
+{
+    const auto column = SelectColumn();
+
+    if (column == Root)
+        return true;
+
+    if (m_ColumnSizes[column] == 0)
+        return false;
+
+    Cover(column);
+
+    bool solved = false;
+
+    for (int node = m_Nodes[column].m_Down; node != column && !solved; node = m_Nodes[node].m_Down)
+    {
+        m_Solution.push_back(GetChoice(node));
+
+        for (int other = m_Nodes[node].m_Right; other != node; other = m_Nodes[other].m_Right)
+            Cover(m_Nodes[other].m_Column);
+
+        solved = Search();
+
+        for (int other = m_Nodes[node].m_Left; other != node; other = m_Nodes[other].m_Left)
+            Uncover(m_Nodes[other].m_Column);
+
+        if (!solved)
+            m_Solution.pop_back();
+    }
+
+    Uncover(column);
+
+    return solved;
+}
+
+template<int TGridSize>
+int DancingLinks<TGridSize>::SelectColumn() const
+{
+    int bestColumn = Root;
+    int bestSize = ChoicesCount + 1;
+
+    for (int column = m_Nodes[Root].m_Right; column != Root; column = m_Nodes[column].m_Right)
+    {
+        if (m_ColumnSizes[column] < bestSize)
+        {
+            bestColumn = column;
+            bestSize = m_ColumnSizes[column];
+
+            if (bestSize <= 1)
+                break;
+        }
+    }
+
+    return bestColumn;
+}
+
+template<int TGridSize>
+void DancingLinks<TGridSize>::Cover(int column)
+{
+    m_Nodes[m_Nodes[column].m_Right].m_Left = m_Nodes[column].m_Left;
+    m_Nodes[m_Nodes[column].m_Left].m_Right = m_Nodes[column].m_Right;
+
+    for (int choiceNode = m_Nodes[column].m_Down; choiceNode != column; choiceNode = m_Nodes[choiceNode].m_Down)
+    {
+        for (int node = m_Nodes[choiceNode].m_Right; node != choiceNode; node = m_Nodes[node].m_Right)
+        {
+            m_Nodes[m_Nodes[node].m_Down].m_Up = m_Nodes[node].m_Up;
+            m_Nodes[m_Nodes[node].m_Up].m_Down = m_Nodes[node].m_Down;
+            m_ColumnSizes[m_Nodes[node].m_Column]--;
+        }
+    }
+}
+
+template<int TGridSize>
+void DancingLinks<TGridSize>::Uncover(int column)
+{
+    for (int choiceNode = m_Nodes[column].m_Up; choiceNode != column; choiceNode = m_Nodes[choiceNode].m_Up)
+    {
+        for (int node = m_Nodes[choiceNode].m_Left; node != choiceNode; node = m_Nodes[node].m_Left)
+        {
+            m_ColumnSizes[m_Nodes[node].m_Column]++;
+            m_Nodes[m_Nodes[node].m_Down].m_Up = node;
+            m_Nodes[m_Nodes[node].m_Up].m_Down = node;
+        }
+    }
+
+    m_Nodes[m_Nodes[column].m_Right].m_Left = column;
+    m_Nodes[m_Nodes[column].m_Left].m_Right = column;
+}
+
+template<int TGridSize>
+void DancingLinks<TGridSize>::RemoveChoice(int choice)
+{
+    for (int node = GetFirstNode(choice); node < GetFirstNode(choice) + NodesPerChoice; node++)
+    {
+        m_Nodes[m_Nodes[node].m_Down].m_Up = m_Nodes[node].m_Up;
+        m_Nodes[m_Nodes[node].m_Up].m_Down = m_Nodes[node].m_Down;
+        m_ColumnSizes[m_Nodes[node].m_Column]--;
+    }
+}
+
+template<int TGridSize>
+void DancingLinks<TGridSize>::RestoreChoice(int choice)
+{
+    for (int node = GetFirstNode(choice) + NodesPerChoice - 1; node >= GetFirstNode(choice); node--)
+    {
+        m_ColumnSizes[m_Nodes[node].m_Column]++;
+        m_Nodes[m_Nodes[node].m_Down].m_Up = node;
+        m_Nodes[m_Nodes[node].m_Up].m_Down = node;
+    }
+}
+
+// A choice whose constraints are all uncovered is still linked in their columns
+template<int TGridSize>
+bool DancingLinks<TGridSize>::SelectChoice(int choice)
+{
+    const auto firstNode = GetFirstNode(choice);
+
+    for (int node = firstNode; node < firstNode + NodesPerChoice; node++)
+    {
+        if (IsCovered(m_Nodes[node].m_Column))
+            return false;
+    }
+
+    Cover(m_Nodes[firstNode].m_Column);
+
+    for (int node = m_Nodes[firstNode].m_Right; node != firstNode; node = m_Nodes[node].m_Right)
+        Cover(m_Nodes[node].m_Column);
+
+    return true;
+}
+
+template<int TGridSize>
+void DancingLinks<TGridSize>::UnselectChoice(int choice)
+{
+    const auto firstNode = GetFirstNode(choice);
+
+    for (int node = m_Nodes[firstNode].m_Left; node != firstNode; node = m_Nodes[node].m_Left)
+        Uncover(m_Nodes[node].m_Column);
+
+    Uncover(m_Nodes[firstNode].m_Column);
+}
+
+template<int TGridSize>
+void DancingLinks<TGridSize>::Store(Grid& grid) const
+{
+    std::array<Possibilities, CellsCount> possibilities;
+
+    for (int cell = 0; cell < CellsCount; cell++)
+        possibilities[cell] = grid.GetPossibilities(cell);
+
+    for (auto choice : m_Solution)
+        possibilities[choice / TGridSize] = PossibilitiesBitSet{1} << (choice % TGridSize);
+
+    grid.SetAllPossibilities(possibilities.data());
+}
+
+template<int TGridSize>
+DancingLinks<TGridSize>& GetDancingLinks()
+{
+    thread_local DancingLinks<TGridSize> dancingLinks;
+    return dancingLinks;
+}
+
+} // anonymous namespace
+
+template<int TGridSize>
+bool DancingLinksGridSolverImpl<TGridSize>::Solve(Grid& grid) const
+{
+    if (grid.GetGridSize() != TGridSize)
+        throw std::runtime_error("Grid of size '" + std::to_string(grid.GetGridSize()) + "' given to solver of size '" + std::to_string(TGridSize) + "'");
+
+    return GetDancingLinks<TGridSize>().Solve(grid);
+}
+
+template class DancingLinksGridSolverImpl<4>;
+template class DancingLinksGridSolverImpl<6>;
+template class DancingLinksGridSolverImpl<9>;
+template class DancingLinksGridSolverImpl<16>;
+template class DancingLinksGridSolverImpl<25>;
+
+} // namespace sudoku
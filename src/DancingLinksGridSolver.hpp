@@ -0,0 +1,22 @@
+#pragma once
+
+#include "GridSolverWithHypothesis.hpp"
+
+namespace sudoku
+{
+
+class Grid;
+
+// Solves the grid as an exact cover problem with Knuth's dancing links: each value of each cell covers its cell,
+// and the value in its row, column and block. The search branches on the constraint with the fewest choices left,
+// which may be a value to place in a unit rather than a cell.
+// The links are allocated once per thread and grid size, and restored after each solve.
+template<int TGridSize>
+class DancingLinksGridSolverImpl final : public GridSolver
+{
+public:
+    // The grid is left unchanged if it can't be solved
+    bool Solve(Grid& grid) const override;
+};
+
+} /* namespace sudoku */
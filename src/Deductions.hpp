@@ -0,0 +1,47 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+namespace sudoku
+{
+
+enum class Deduction
+{
+    // Pointing and claiming: a value of a block confined to one of its rows or columns,
+    // or a value of a row or column confined to one block
+    LockedCandidates,
+    // Pairs and triples of cells of a unit sharing as many values between them
+    NakedSubsets,
+    // Pairs and triples of values of a unit sharing as many cells between them
+    HiddenSubsets
+};
+
+constexpr int DeductionsCount {3};
+
+// Accumulated over all the grids solved
+struct DeductionProfile
+{
+    std::uint64_t m_Tries {0};
+    // Tries which removed at least one possibility
+    std::uint64_t m_Hits {0};
+    std::uint64_t m_PossibilitiesRemoved {0};
+    // Time stamp counter ticks, nanoseconds where there is no such counter
+    std::uint64_t m_Cycles {0};
+};
+
+// Indexed by Deduction
+using DeductionsProfile = std::array<DeductionProfile, DeductionsCount>;
+
+// Deductions tried once the single possibilities are exhausted, before making a hypothesis
+struct Deductions
+{
+    // A deduction is only tried once the ones before it have nothing left to remove, the cheapest should come first
+    std::vector<Deduction> m_Order;
+
+    // Filled when set, the solver can then only be used by one thread at a time
+    DeductionsProfile* m_Profile {nullptr};
+};
+
+} // namespace sudoku
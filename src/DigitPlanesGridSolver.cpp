@@ -0,0 +1,535 @@
+#include "DigitPlanesGridSolver.hpp"
+
+#include <array>
+#include <cstdint>
+#include <limits>
+
+#include "Grid.hpp"
+#include "GridSize.hpp"
+#include "GridUnits.hpp"
+
+namespace sudoku
+{
+
+namespace
+{
+
+bool HasSingleBit(UnitSlotsBitSet slots)
+{
+    return slots != 0 && (slots & (slots - 1)) == 0;
+}
+
+// One bit per cell of the grid, in the order of the cell indexes
+template<int TGridSize>
+class CellsPlane
+{
+public:
+    static constexpr int WordsCount {(GetCellsNumberInGrid(TGridSize) + 63) / 64};
+
+    void Set(int index) { m_Words[index / 64] |= Bit(index); }
+    void Reset(int index) { m_Words[index / 64] &= ~Bit(index); }
+    bool Test(int index) const { return (m_Words[index / 64] & Bit(index)) != 0; }
+
+    // Bit i set if the cell of column i is in the plane
+    UnitSlotsBitSet GetRow(int row) const
+    {
+        const int first = row * TGridSize;
+        const int word = first / 64;
+        const int shift = first % 64;
+
+        auto bits = m_Words[word] >> shift;
+
+        if (shift + TGridSize > 64)
+            bits |= m_Words[word + 1] << (64 - shift);
+
+        return static_cast<UnitSlotsBitSet>(bits & ((std::uint64_t{1} << TGridSize) - 1));
+    }
+
+    bool IsEmpty() const
+    {
+        std::uint64_t any {};
+
+        for (auto word : m_Words)
+            any |= word;
+
+        return any == 0;
+    }
+
+    // Undefined if the plane is empty
+    int GetFirstCell() const
+    {
+        int word = 0;
+
+        while (m_Words[word] == 0)
+            word++;
+
+        return word * 64 + __builtin_ctzll(m_Words[word]);
+    }
+
+    template<typename TFunction>
+    void ForEachCell(TFunction function) const
+    {
+        for (int word = 0; word < WordsCount; word++)
+        {
+            for (auto bits = m_Words[word]; bits != 0; bits &= bits - 1)
+                function(word * 64 + __builtin_ctzll(bits));
+        }
+    }
+
+    CellsPlane operator&(CellsPlane const& other) const { return Combine(other, [](auto lhs, auto rhs){ return lhs & rhs; }); }
+    CellsPlane operator|(CellsPlane const& other) const { return Combine(other, [](auto lhs, auto rhs){ return lhs | rhs; }); }
+
+    // Cells of this plane which aren't in other
+    CellsPlane Without(CellsPlane const& other) const { return Combine(other, [](auto lhs, auto rhs){ return lhs & ~rhs; }); }
+
+    bool operator==(CellsPlane const& other) const { return m_Words == other.m_Words; }
+
+private:
+    static std::uint64_t Bit(int index) { return std::uint64_t{1} << (index % 64); }
+
+    template<typename TOperation>
+    CellsPlane Combine(CellsPlane const& other, TOperation operation) const
+    {
+        CellsPlane result;
+
+        for (int word = 0; word < WordsCount; word++)
+            result.m_Words[word] = operation(m_Words[word], other.m_Words[word]);
+
+        return result;
+    }
+
+    std::array<std::uint64_t, WordsCount> m_Words {};
+};
+
+template<int TGridSize>
+struct PlaneMasks
+{
+    CellsPlane<TGridSize> m_AllCells;
+
+    // The cells sharing a unit with each cell, the cell excluded
+    std::array<CellsPlane<TGridSize>, GetCellsNumberInGrid(TGridSize)> m_RelatedCells;
+};
+
+template<int TGridSize>
+PlaneMasks<TGridSize> CreatePlaneMasks()
+{
+    auto const& units = GridUnits::Get(TGridSize);
+
+    std::array<CellsPlane<TGridSize>, GetGroupsNumberInGrid(TGridSize)> unitsCells;
+
+    for (int unit = 0; unit < units.GetUnitsCount(); unit++)
+    {
+        for (int slot = 0; slot < TGridSize; slot++)
+            unitsCells[unit].Set(units.GetCellIndex(unit, slot));
+    }
+
+    PlaneMasks<TGridSize> masks;
+
+    for (int index = 0; index < GetCellsNumberInGrid(TGridSize); index++)
+    {
+        masks.m_AllCells.Set(index);
+
+        for (auto const& cellSlot : units.GetCellSlots(index))
+            masks.m_RelatedCells[index] = masks.m_RelatedCells[index] | unitsCells[cellSlot.m_Unit];
+
+        masks.m_RelatedCells[index].Reset(index);
+    }
+
+    return masks;
+}
+
+template<int TGridSize>
+PlaneMasks<TGridSize> const& GetPlaneMasks()
+{
+    static const auto masks = CreatePlaneMasks<TGridSize>();
+    return masks;
+}
+
+// Bit i of each member is the i-th unit of that kind, blocks numbered as in GridUnits
+struct SetUnits
+{
+    UnitSlotsBitSet m_Rows;
+    UnitSlotsBitSet m_Columns;
+    UnitSlotsBitSet m_Blocks;
+};
+
+template<int TGridSize>
+class DigitPlanes
+{
+public:
+    using Plane = CellsPlane<TGridSize>;
+
+    // False if a cell of the grid has no possibility left
+    bool Load(Grid const& grid);
+
+    void Store(Grid& grid) const;
+
+    // onSolution(planes) is called on every solution found, the search ends leaving the planes solved when it returns true
+    template<typename TOnSolution>
+    bool Search(TOnSolution const& onSolution);
+
+private:
+    static constexpr int BlockRows {GetBlockRows(TGridSize)};
+    static constexpr int BlockCols {GetBlockCols(TGridSize)};
+    static constexpr UnitSlotsBitSet AllSlots {(UnitSlotsBitSet{1} << TGridSize) - 1};
+
+    bool Propagate();
+
+    // False if a cell has no value left
+    bool SetNakedSingles();
+
+    // False if a value has no cell left in a unit
+    bool SetHiddenSingles(bool& valueSet);
+
+    void SetHiddenSingle(int value, int index, bool& valueSet);
+
+    int SelectHypothesisCell() const;
+
+    void SetValue(int value, int index);
+
+    // Plane i holds the cells where value i + 1 can still go
+    std::array<Plane, TGridSize> m_Values;
+
+    // Units in which each value is set
+    std::array<SetUnits, TGridSize> m_SetUnits {};
+
+    // Cells whose value has been removed from their related cells
+    Plane m_SetCells;
+};
+
+template<int TGridSize>
+bool DigitPlanes<TGridSize>::Load(Grid const& grid)
+{
+    for (int index = 0; index < GetCellsNumberInGrid(TGridSize); index++)
+    {
+        const auto bitSet = grid.GetPossibilities(index).GetBitSet();
+
+        if (bitSet == 0)
+            return false;
+
+        for (auto values = bitSet; values != 0; values &= values - 1)
+            m_Values[__builtin_ctz(values)].Set(index);
+    }
+
+    return true;
+}
+
+template<int TGridSize>
+void DigitPlanes<TGridSize>::Store(Grid& grid) const
+{
+    std::array<Possibilities, GetCellsNumberInGrid(TGridSize)> possibilities;
+
+    for (int index = 0; index < GetCellsNumberInGrid(TGridSize); index++)
+    {
+        PossibilitiesBitSet bitSet {};
+
+        for (int value = 0; value < TGridSize; value++)
+            bitSet |= PossibilitiesBitSet{m_Values[value].Test(index)} << value;
+
+        possibilities[index] = bitSet;
+    }
+
+    grid.SetAllPossibilities(possibilities.data());
+}
+
+// The values are tried from the highest, as in GridSolverWithHypothesisImpl
+template<int TGridSize>
+template<typename TOnSolution>
+bool DigitPlanes<TGridSize>::Search(TOnSolution const& onSolution)
+{
+    if (!Propagate())
+        return false;
+
+    if (m_SetCells == GetPlaneMasks<TGridSize>().m_AllCells)
+        return onSolution(static_cast<DigitPlanes const&>(*this));
+
+    const auto index = SelectHypothesisCell();
+
+    for (int value = TGridSize - 1; value >= 0; value--)
+    {
+        if (!m_Values[value].Test(index))
+            continue;
+
+        auto hypothesis = *this;
+        hypothesis.SetValue(value, index);
+
+        if (hypothesis.Search(onSolution))
+        {
+            *this = hypothesis;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+template<int TGridSize>
+bool DigitPlanes<TGridSize>::Propagate()
+{
+    bool valueSet = true;
+
+    while (valueSet)
+    {
+        if (!SetNakedSingles() || !SetHiddenSingles(valueSet))
+            return false;
+    }
+
+    return true;
+}
+
+template<int TGridSize>
+bool DigitPlanes<TGridSize>::SetNakedSingles()
+{
+    while (true)
+    {
+        // Cells with at least one, and at least two values left
+        Plane once;
+        Plane twice;
+
+        for (auto const& plane : m_Values)
+        {
+            twice = twice | (once & plane);
+            once = once | plane;
+        }
+
+        if (!(once == GetPlaneMasks<TGridSize>().m_AllCells))
+            return false;
+
+        const auto singles = once.Without(twice).Without(m_SetCells);
+
+        if (singles.IsEmpty())
+            return true;
+
+        for (int value = 0; value < TGridSize; value++)
+        {
+            // A single set earlier in the loop may have removed the value from the cell, left empty
+            (m_Values[value] & singles).ForEachCell([this, value](int index)
+                {
+                    if (m_Values[value].Test(index))
+                        SetValue(value, index);
+                });
+        }
+    }
+}
+
+// The rows of each band of blocks are folded into the columns where the value is seen at least once
+// and at least twice, which gives the blocks of the band, then the bands give the columns of the grid.
+template<int TGridSize>
+bool DigitPlanes<TGridSize>::SetHiddenSingles(bool& valueSet)
+{
+    constexpr UnitSlotsBitSet blockSlots {(UnitSlotsBitSet{1} << BlockCols) - 1};
+
+    valueSet = false;
+
+    for (int value = 0; value < TGridSize; value++)
+    {
+        auto const& plane = m_Values[value];
+        auto const& setUnits = m_SetUnits[value];
+
+        if (setUnits.m_Rows == AllSlots)
+            continue;
+
+        UnitSlotsBitSet columnsOnce {};
+        UnitSlotsBitSet columnsTwice {};
+
+        for (int bandRow = 0; bandRow < TGridSize; bandRow += BlockRows)
+        {
+            UnitSlotsBitSet bandOnce {};
+            UnitSlotsBitSet bandTwice {};
+
+            for (int row = bandRow; row < bandRow + BlockRows; row++)
+            {
+                const auto columns = plane.GetRow(row);
+
+                if (columns == 0)
+                    return false;
+
+                if (HasSingleBit(columns) && (setUnits.m_Rows & (UnitSlotsBitSet{1} << row)) == 0)
+                    SetHiddenSingle(value, row * TGridSize + __builtin_ctz(columns), valueSet);
+
+                bandTwice |= bandOnce & columns;
+                bandOnce |= columns;
+            }
+
+            for (int blockCol = 0; blockCol < TGridSize; blockCol += BlockCols)
+            {
+                const auto block = (bandRow / BlockRows) * (TGridSize / BlockCols) + blockCol / BlockCols;
+                const auto blockColumns = bandOnce & (blockSlots << blockCol);
+
+                if (blockColumns == 0)
+                    return false;
+
+                if (!HasSingleBit(blockColumns) || (bandTwice & blockColumns) != 0 || (setUnits.m_Blocks & (UnitSlotsBitSet{1} << block)) != 0)
+                    continue;
+
+                const auto column = __builtin_ctz(blockColumns);
+
+                for (int row = bandRow; row < bandRow + BlockRows; row++)
+                {
+                    if (plane.Test(row * TGridSize + column))
+                        SetHiddenSingle(value, row * TGridSize + column, valueSet);
+                }
+            }
+
+            columnsTwice |= bandTwice | (columnsOnce & bandOnce);
+            columnsOnce |= bandOnce;
+        }
+
+        if (columnsOnce != AllSlots)
+            return false;
+
+        for (auto columns = AllSlots & ~columnsTwice & ~setUnits.m_Columns; columns != 0; columns &= columns - 1)
+        {
+            const auto column = __builtin_ctz(columns);
+
+            for (int row = 0; row < TGridSize; row++)
+            {
+                if (plane.Test(row * TGridSize + column))
+                    SetHiddenSingle(value, row * TGridSize + column, valueSet);
+            }
+        }
+    }
+
+    return true;
+}
+
+// The units were folded before the values set earlier in the pass: the value may have been removed
+// from the cell since, the unit left without it is found on the next pass
+template<int TGridSize>
+void DigitPlanes<TGridSize>::SetHiddenSingle(int value, int index, bool& valueSet)
+{
+    if (!m_Values[value].Test(index) || m_SetCells.Test(index))
+        return;
+
+    SetValue(value, index);
+    valueSet = true;
+}
+
+// A cell with two values left if any, found by counting the planes bitwise, else the cell with the fewest
+template<int TGridSize>
+int DigitPlanes<TGridSize>::SelectHypothesisCell() const
+{
+    Plane once;
+    Plane twice;
+    Plane thrice;
+
+    for (auto const& plane : m_Values)
+    {
+        thrice = thrice | (twice & plane);
+        twice = twice | (once & plane);
+        once = once | plane;
+    }
+
+    const auto pairs = twice.Without(thrice).Without(m_SetCells);
+
+    if (!pairs.IsEmpty())
+        return pairs.GetFirstCell();
+
+    int bestIndex {};
+    int bestCount = std::numeric_limits<int>::max();
+
+    GetPlaneMasks<TGridSize>().m_AllCells.Without(m_SetCells).ForEachCell([&](int index)
+        {
+            int count {};
+
+            for (auto const& plane : m_Values)
+                count += plane.Test(index);
+
+            if (count < bestCount)
+            {
+                bestCount = count;
+                bestIndex = index;
+            }
+        });
+
+    return bestIndex;
+}
+
+template<int TGridSize>
+void DigitPlanes<TGridSize>::SetValue(int value, int index)
+{
+    for (auto& plane : m_Values)
+        plane.Reset(index);
+
+    m_Values[value] = m_Values[value].Without(GetPlaneMasks<TGridSize>().m_RelatedCells[index]);
+    m_Values[value].Set(index);
+
+    m_SetCells.Set(index);
+
+    const auto row = index / TGridSize;
+    const auto column = index % TGridSize;
+    const auto block = (row / BlockRows) * (TGridSize / BlockCols) + column / BlockCols;
+
+    m_SetUnits[value].m_Rows |= UnitSlotsBitSet{1} << row;
+    m_SetUnits[value].m_Columns |= UnitSlotsBitSet{1} << column;
+    m_SetUnits[value].m_Blocks |= UnitSlotsBitSet{1} << block;
+}
+
+template<int TGridSize>
+void CheckGridSize(Grid const& grid)
+{
+    if (grid.GetGridSize() != TGridSize)
+        throw std::runtime_error("Grid of size '" + std::to_string(grid.GetGridSize()) + "' given to solver of size '" + std::to_string(TGridSize) + "'");
+}
+
+} // anonymous namespace
+
+template<int TGridSize>
+bool DigitPlanesGridSolverImpl<TGridSize>::Solve(Grid& grid) const
+{
+    CheckGridSize<TGridSize>(grid);
+
+    DigitPlanes<TGridSize> planes;
+
+    if (!planes.Load(grid) || !planes.Search([](DigitPlanes<TGridSize> const&){ return true; }))
+        return false;
+
+    planes.Store(grid);
+    return true;
+}
+
+template<int TGridSize>
+int DigitPlanesGridSolverImpl<TGridSize>::CountSolutions(Grid const& grid, int limit) const
+{
+    CheckGridSize<TGridSize>(grid);
+
+    DigitPlanes<TGridSize> planes;
+    int solutionsCount = 0;
+
+    if (limit > 0 && planes.Load(grid))
+        planes.Search([&solutionsCount, limit](DigitPlanes<TGridSize> const&){ return ++solutionsCount == limit; });
+
+    return solutionsCount;
+}
+
+// Only the solutions visited are stored to a grid
+template<int TGridSize>
+std::int64_t DigitPlanesGridSolverImpl<TGridSize>::EnumerateSolutions(Grid const& grid, SolutionVisitor const& visitor) const
+{
+    CheckGridSize<TGridSize>(grid);
+
+    DigitPlanes<TGridSize> planes;
+    Grid solution {TGridSize};
+    std::int64_t solutionsCount = 0;
+
+    if (planes.Load(grid))
+    {
+        planes.Search([&solution, &solutionsCount, &visitor](DigitPlanes<TGridSize> const& solvedPlanes)
+            {
+                solutionsCount++;
+                solvedPlanes.Store(solution);
+
+                return !visitor(solution);
+            });
+    }
+
+    return solutionsCount;
+}
+
+template class DigitPlanesGridSolverImpl<4>;
+template class DigitPlanesGridSolverImpl<6>;
+template class DigitPlanesGridSolverImpl<9>;
+template class DigitPlanesGridSolverImpl<16>;
+template class DigitPlanesGridSolverImpl<25>;
+
+} // namespace sudoku
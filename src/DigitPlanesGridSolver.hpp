@@ -0,0 +1,24 @@
+#pragma once
+
+#include "GridSolverWithHypothesis.hpp"
+
+namespace sudoku
+{
+
+class Grid;
+
+// Keeps for each value a plane with one bit per cell where the value can still go, instead of the
+// possibilities of each cell. A value set in a cell is removed from all the cells related to it with one
+// mask per word of the plane, and the cells left with one value are found by counting the planes bitwise.
+template<int TGridSize>
+class DigitPlanesGridSolverImpl final : public GridSolver, public SolutionsFinder
+{
+public:
+    // The grid is left unchanged if it can't be solved
+    bool Solve(Grid& grid) const override;
+
+    int CountSolutions(Grid const& grid, int limit) const override;
+    std::int64_t EnumerateSolutions(Grid const& grid, SolutionVisitor const& visitor) const override;
+};
+
+} /* namespace sudoku */
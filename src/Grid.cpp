@@ -1,59 +1,49 @@
 #include "Grid.hpp"
 
-#include <cmath>
+#include <algorithm>
+#include <cstring>
 
 #include <boost/range/irange.hpp>
 
-namespace sudoku
-{
+#include "GridSize.hpp"
+#include "GridText.hpp"
 
-namespace constants
+namespace sudoku
 {
-const std::string VerticalSeparator = "|";
-constexpr char EmptyCellChar = '*';
-} // namespace constants
 
 namespace
 {
 
-int CalculateBlockSize(int gridSize)
-{
-    auto blockSize = sqrt(gridSize);
-
-    if (blockSize != (int)blockSize)
-        throw std::runtime_error("Can't deduce block size from grid size '" + std::to_string(gridSize) + "'");
+constexpr char EmptyCellChar = '*';
 
-    return blockSize;
+int GetCellWidth(int gridSize)
+{
+    return std::to_string(gridSize).size();
 }
 
-void PrintHorizontalLine(std::ostream& os, int gridSize, int blockSize)
+void AppendHorizontalLine(std::string& text, int gridSize, int blockCols)
 {
+    const auto cellSeparator = std::string(GetCellWidth(gridSize) + 1, '-');
+
     for (auto col : boost::irange(0, gridSize))
     {
-        if (col % blockSize == 0)
-            os << "+";
+        if (col % blockCols == 0)
+            text += '+';
 
-        os << "--";
+        text += cellSeparator;
     }
 
-    os << "+" << std::endl;
-}
-
-void PrintVerticalSeparator(std::ostream& os)
-{
-    os << constants::VerticalSeparator;
+    text += "+\n";
 }
 
-void PrintCell(std::ostream& os, Cell const& cell)
+void AppendCell(std::string& text, ConstCell const& cell, int cellWidth)
 {
-    auto value = cell.GetValue();
-
-    if (value)
-        os << *value;
-    else
-        os << constants::EmptyCellChar;
+    const auto value = cell.GetValue();
+    const auto cellText = value ? std::to_string(*value) : std::string(1, EmptyCellChar);
 
-    os << " ";
+    text.append(cellWidth - cellText.size(), ' ');
+    text += cellText;
+    text += ' ';
 }
 
 } // anonymous namespace
@@ -61,80 +51,247 @@ void PrintCell(std::ostream& os, Cell const& cell)
 Grid::Grid(int gridSize) :
     m_GridSize(gridSize)
 {
-    m_Cells.reserve(gridSize * gridSize);
-
     if (gridSize < 4)
         throw std::runtime_error("Invalid Sudoku grid size '" + std::to_string(gridSize) + "', because: too small.");
 
-    for(auto row : boost::irange(0, m_GridSize))
+    if (!HasValidBlocks(gridSize))
+        throw std::runtime_error("Invalid Sudoku grid size '" + std::to_string(gridSize) + "', because: can't be split in blocks.");
+
+    m_Units = &GridUnits::Get(gridSize);
+
+    AllocateStorage(0);
+
+    const Possibilities allPossibilities {gridSize};
+    const auto allSlots = (UnitSlotsBitSet{1} << gridSize) - 1;
+
+    std::uninitialized_fill_n(m_Possibilities, GetCellsCount(), allPossibilities);
+    std::uninitialized_fill_n(m_PlacedValues, m_Units->GetUnitsCount(), PossibilitiesBitSet{});
+    std::uninitialized_fill_n(m_ValueLocations, m_Units->GetUnitsCount() * gridSize, allSlots);
+
+    // All the cells have gridSize possibilities, no need to count them
+    const auto cellsWords = GetCellsWordsCount();
+
+    std::uninitialized_fill_n(m_CellsByPossibilitiesCount, (gridSize + 1) * cellsWords, std::uint64_t{});
+
+    for (int word = 0; word < cellsWords; word++)
     {
-        for(auto col : boost::irange(0, m_GridSize))
-        {
-            m_Cells.emplace_back(Position{row, col}, gridSize);
-        }
+        const auto cellsInWord = std::min(GetCellsCount() - word * 64, 64);
+        m_CellsByPossibilitiesCount[gridSize * cellsWords + word] = cellsInWord == 64 ? ~std::uint64_t{0} : (std::uint64_t{1} << cellsInWord) - 1;
     }
+
+    m_UnsetCellsCount = GetCellsCount();
 }
 
 Grid::Grid(Grid const& grid) :
-    m_GridSize(grid.GetGridSize())
+    m_GridSize(grid.m_GridSize),
+    m_Units(grid.m_Units),
+    m_TouchedUnits(grid.m_TouchedUnits),
+    m_UnsetCellsCount(grid.m_UnsetCellsCount)
 {
-    m_Cells.reserve(grid.GetGridSize() * grid.GetGridSize());
+    AllocateStorage(0);
 
-    std::copy(grid.begin(), grid.end(), std::back_inserter(m_Cells));
+    std::memcpy(GetStorage(), grid.GetStorage(), detail::GetGridStorageSize(m_GridSize));
+}
+
+Grid::Grid(Grid&& grid) noexcept :
+    m_GridSize(grid.m_GridSize),
+    m_Units(grid.m_Units),
+    m_TouchedUnits(grid.m_TouchedUnits),
+    m_UnsetCellsCount(grid.m_UnsetCellsCount),
+    m_HeapStorage(std::move(grid.m_HeapStorage))
+{
+    if (!m_HeapStorage)
+        std::memcpy(m_InlineStorage, grid.m_InlineStorage, detail::GetGridStorageSize(m_GridSize));
+
+    PointIntoStorage();
+
+    grid.m_GridSize = 0;
+    grid.m_UnsetCellsCount = 0;
+    grid.PointIntoStorage();
 }
 
 Grid& Grid::operator=(Grid const& grid)
 {
-    std::copy(grid.begin(), grid.end(), m_Cells.begin());
+    if (this == &grid)
+        return *this;
+
+    const auto previousGridSize = m_GridSize;
+
+    m_GridSize = grid.m_GridSize;
+    m_Units = grid.m_Units;
+
+    AllocateStorage(previousGridSize);
+
+    std::memcpy(GetStorage(), grid.GetStorage(), detail::GetGridStorageSize(m_GridSize));
+
+    m_TouchedUnits = grid.m_TouchedUnits;
+    m_UnsetCellsCount = grid.m_UnsetCellsCount;
 
     return *this;
 }
 
-Cell& Grid::GetCell(Position const& position)
+Grid& Grid::operator=(Grid&& grid) noexcept
 {
-    return m_Cells.at(position.m_Row * m_GridSize + position.m_Col);
+    if (this == &grid)
+        return *this;
+
+    // An inline storage has to be copied anyway
+    if (!grid.m_HeapStorage)
+        return *this = static_cast<Grid const&>(grid);
+
+    m_GridSize = grid.m_GridSize;
+    m_Units = grid.m_Units;
+    m_TouchedUnits = grid.m_TouchedUnits;
+    m_UnsetCellsCount = grid.m_UnsetCellsCount;
+    m_HeapStorage = std::move(grid.m_HeapStorage);
+
+    PointIntoStorage();
+
+    grid.m_GridSize = 0;
+    grid.m_UnsetCellsCount = 0;
+    grid.PointIntoStorage();
+
+    return *this;
 }
 
-Cell const& Grid::GetCell(Position const& position) const
+void Grid::AllocateStorage(int previousGridSize)
 {
-    return m_Cells.at(position.m_Row * m_GridSize + position.m_Col);
+    const auto storageSize = detail::GetGridStorageSize(m_GridSize);
+
+    if (storageSize <= sizeof(m_InlineStorage))
+        m_HeapStorage.reset();
+    else if (!m_HeapStorage || previousGridSize != m_GridSize)
+        m_HeapStorage.reset(new std::byte[storageSize]);
+
+    PointIntoStorage();
 }
 
-int Grid::GetGridSize() const
+// The words of the cells by possibilities count first, as they are the only 8 bytes entries
+void Grid::PointIntoStorage()
 {
-    return m_GridSize;
+    const auto unitsCount = GridUnits::UnitsPerCell * m_GridSize;
+
+    auto* storage = GetStorage();
+
+    m_CellsByPossibilitiesCount = reinterpret_cast<std::uint64_t*>(storage);
+    storage += (m_GridSize + 1) * GetCellsWordsCount() * sizeof(std::uint64_t);
+
+    m_Possibilities = reinterpret_cast<Possibilities*>(storage);
+    storage += GetCellsCount() * sizeof(Possibilities);
+
+    m_PlacedValues = reinterpret_cast<PossibilitiesBitSet*>(storage);
+    storage += unitsCount * sizeof(PossibilitiesBitSet);
+
+    m_ValueLocations = reinterpret_cast<UnitSlotsBitSet*>(storage);
+}
+
+void Grid::SetAllPossibilities(Possibilities const* possibilities)
+{
+    if (m_Trail)
+        throw std::runtime_error("Can't replace all the possibilities of a grid while its modifications are recorded");
+
+    std::copy_n(possibilities, GetCellsCount(), m_Possibilities);
+
+    RebuildUnits();
+}
+
+void Grid::RebuildUnits()
+{
+    std::fill_n(m_PlacedValues, m_Units->GetUnitsCount(), PossibilitiesBitSet{});
+    std::fill_n(m_ValueLocations, m_Units->GetUnitsCount() * m_GridSize, UnitSlotsBitSet{});
+
+    for (int index = 0; index < GetCellsCount(); index++)
+    {
+        auto const& possibilities = m_Possibilities[index];
+
+        for (auto const& [unit, slot] : m_Units->GetCellSlots(index))
+        {
+            for (auto values = possibilities.GetBitSet(); values != 0; values &= values - 1)
+                m_ValueLocations[unit * m_GridSize + __builtin_ctz(values)] |= UnitSlotsBitSet{1} << slot;
+
+            if (possibilities.OnlyOnePossibilityLeft())
+                m_PlacedValues[unit] |= possibilities.GetBitSet();
+        }
+    }
+
+    RebuildPossibilitiesCounts();
+    TouchAllUnits();
+}
+
+void Grid::RebuildPossibilitiesCounts()
+{
+    const auto cellsWords = GetCellsWordsCount();
+
+    std::fill_n(m_CellsByPossibilitiesCount, (m_GridSize + 1) * cellsWords, std::uint64_t{});
+
+    m_UnsetCellsCount = 0;
+
+    for (int index = 0; index < GetCellsCount(); index++)
+    {
+        const auto count = m_Possibilities[index].Count();
+
+        m_CellsByPossibilitiesCount[count * cellsWords + index / 64] |= std::uint64_t{1} << (index % 64);
+        m_UnsetCellsCount += count != 1;
+    }
 }
 
 std::ostream& operator<<(std::ostream& os, Grid const& grid)
 {
-    const auto blockSize = CalculateBlockSize(grid.GetGridSize());
+    char line[MaxGridLineLength];
+    FormatGrid(grid, line);
+
+    return os.write(line, grid.GetCellsCount());
+}
+
+std::ostream& operator<<(std::ostream& os, PrettyGrid const& prettyGrid)
+{
+    auto const& grid = prettyGrid.m_Grid;
+
+    const auto blockRows = GetBlockRows(grid.GetGridSize());
+    const auto blockCols = GetBlockCols(grid.GetGridSize());
+    const auto cellWidth = GetCellWidth(grid.GetGridSize());
+
+    // Written at once, without flushing the stream
+    std::string text;
 
     for(auto row : boost::irange(0, grid.GetGridSize()))
     {
-        if (row % blockSize == 0)
-            PrintHorizontalLine(os, grid.GetGridSize(), blockSize);
+        if (row % blockRows == 0)
+            AppendHorizontalLine(text, grid.GetGridSize(), blockCols);
 
         for(auto col : boost::irange(0, grid.GetGridSize()))
         {
-            if (col % blockSize == 0)
-                PrintVerticalSeparator(os);
+            if (col % blockCols == 0)
+                text += '|';
 
-            PrintCell(os, grid.GetCell(Position{row, col}));
+            AppendCell(text, grid.GetCell(Position{row, col}), cellWidth);
         }
 
-        PrintVerticalSeparator(os);
-        os << std::endl;
+        text += "|\n";
     }
 
-    PrintHorizontalLine(os, grid.GetGridSize(), blockSize);
+    AppendHorizontalLine(text, grid.GetGridSize(), blockCols);
+
+    return os.write(text.data(), text.size());
+}
 
-    return os;
+void PrintTo(Grid const& grid, std::ostream* os)
+{
+    *os << '\n' << PrettyGrid {grid};
 }
 
 bool operator==(Grid const& lhs, Grid const& rhs)
 {
-    return lhs.GetGridSize() == rhs.GetGridSize()
-            && std::equal(lhs.begin(), lhs.end(), rhs.begin());
+    if (lhs.GetGridSize() != rhs.GetGridSize())
+        return false;
+
+    for (int index = 0; index < lhs.GetCellsCount(); index++)
+    {
+        if (!(lhs.GetPossibilities(index) == rhs.GetPossibilities(index)))
+            return false;
+    }
+
+    return true;
 }
 
 } // namespace sudoku
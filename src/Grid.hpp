@@ -1,40 +1,322 @@
 #pragma once
 
+#include <array>
+#include <cstddef>
+#include <memory>
 #include <ostream>
-#include <vector>
 
 #include "Cell.hpp"
+#include "Constants.hpp"
+#include "GridUnits.hpp"
+#include "Trail.hpp"
 
 namespace sudoku
 {
 
+namespace detail
+{
+// Bytes of the possibilities of a grid and of the indexes kept with them, see Grid::PointIntoStorage for the layout
+constexpr std::size_t GetGridStorageSize(int gridSize)
+{
+    const std::size_t cellsCount = gridSize * gridSize;
+    const std::size_t unitsCount = GridUnits::UnitsPerCell * gridSize;
+
+    return (gridSize + 1) * ((cellsCount + 63) / 64) * sizeof(std::uint64_t)
+            + cellsCount * sizeof(Possibilities)
+            + unitsCount * sizeof(PossibilitiesBitSet)
+            + unitsCount * gridSize * sizeof(UnitSlotsBitSet);
+}
+} // namespace detail
+
+// Possibilities of the cells packed by index (row * gridSize + col).
+// They are kept with the indexes below in a single block sized for the grid size, which copying a grid copies at once:
+// 1564 bytes for a 9x9 grid. The block is inside the grid up to InlineGridSize, and allocated for larger grids.
+// While a trail is attached, every modification of the possibilities is recorded in it.
+// For each unit, the values set in its cells and the cells where each value is still possible
+// are kept up to date with every modification of the possibilities, along with the units
+// where a possibility was removed since they were last taken, and the cells bucketed by possibilities count.
 class Grid
 {
 public:
+    // Grids up to this size aren't allocated
+    static constexpr int InlineGridSize {9};
+
     Grid(int gridSize);
     Grid(Grid const& grid);
 
+    // A grid moved from is left without cells, until it is assigned
+    Grid(Grid&& grid) noexcept;
+
     Grid& operator=(Grid const& grid);
+    Grid& operator=(Grid&& grid) noexcept;
+
+    CellIterator<Grid const> begin() const { return {*this, 0}; }
+    CellIterator<Grid const> end() const { return {*this, GetCellsCount()}; }
+
+    CellIterator<Grid> begin() { return {*this, 0}; }
+    CellIterator<Grid> end() { return {*this, GetCellsCount()}; }
+
+    Cell GetCell(Position const& position) { return {*this, GetIndex(position)}; }
+    ConstCell GetCell(Position const& position) const { return {*this, GetIndex(position)}; }
+
+    Cell GetCell(int index) { return {*this, index}; }
+    ConstCell GetCell(int index) const { return {*this, index}; }
+
+    int GetGridSize() const { return m_GridSize; }
+    int GetCellsCount() const { return m_GridSize * m_GridSize; }
+
+    int GetIndex(Position const& position) const { return position.m_Row * m_GridSize + position.m_Col; }
+    Position GetPosition(int index) const { return {index / m_GridSize, index % m_GridSize}; }
+
+    Possibilities const& GetPossibilities(int index) const { return m_Possibilities[index]; }
+
+    GridUnits const& GetUnits() const { return *m_Units; }
+
+    // Values set in at least one cell of the unit
+    PossibilitiesBitSet GetPlacedValues(int unit) const { return m_PlacedValues[unit]; }
+
+    // Cells of the unit where value is still possible
+    UnitSlotsBitSet GetValueLocations(int unit, Value const& value) const { return m_ValueLocations[unit * m_GridSize + value - 1]; }
+
+    // Words of the sets of cells, bit i of word k is the cell of index k * 64 + i
+    int GetCellsWordsCount() const { return (GetCellsCount() + 63) / 64; }
+
+    std::uint64_t const* GetCellsWithPossibilitiesCount(int possibilitiesCount) const
+    {
+        return m_CellsByPossibilitiesCount + possibilitiesCount * GetCellsWordsCount();
+    }
+
+    int GetUnsetCellsCount() const { return m_UnsetCellsCount; }
+
+    // Lowest index among the cells with the fewest possibilities left, set cells excepted.
+    // Returns -1 if all the cells are set.
+    int GetCellWithFewestPossibilities() const;
 
-    auto begin() const { return m_Cells.begin(); }
-    auto end() const { return m_Cells.end(); }
+    GridUnits::UnitsBitSet TakeTouchedUnits()
+    {
+        const auto touchedUnits = m_TouchedUnits;
+        m_TouchedUnits = {};
 
-    auto begin() { return m_Cells.begin(); }
-    auto end() { return m_Cells.end(); }
+        return touchedUnits;
+    }
 
-    Cell& GetCell(Position const& position);
-    Cell const& GetCell(Position const& position) const;
+    // Returns false if the cell has no possibility left
+    bool RemovePossibility(int index, Value const& value)
+    {
+        auto possibilities = m_Possibilities[index];
 
-    int GetGridSize() const;
+        if (possibilities.Contains(value))
+        {
+            possibilities.RemovePossibility(value);
+            Update(index, possibilities);
+        }
+
+        return possibilities.GetBitSet() != 0;
+    }
+
+    void SetValue(int index, Value const& value)
+    {
+        auto possibilities = m_Possibilities[index];
+        possibilities.SetValue(value);
+
+        Update(index, possibilities);
+    }
+
+    // Replaces the possibilities of all the cells and rebuilds the units, instead of updating them cell by cell.
+    // Throws if a trail is attached.
+    void SetAllPossibilities(Possibilities const* possibilities);
+
+    // The trail isn't copied with the grid, and assigning a grid isn't recorded
+    void SetTrail(Trail* trail) { m_Trail = trail; }
+    Trail* GetTrail() const { return m_Trail; }
+
+    Trail::Checkpoint GetTrailCheckpoint() { return m_Trail->GetCheckpoint(); }
+
+    void RollBack(Trail::Checkpoint checkpoint)
+    {
+        m_Trail->RollBack(checkpoint, [this](int index, Possibilities const& possibilities){ Assign(index, possibilities); });
+
+        // Units taken after the checkpoint may not have been examined in the state rolled back to
+        TouchAllUnits();
+    }
 
 private:
-    std::vector<Cell> m_Cells;
+    void Update(int index, Possibilities const& possibilities)
+    {
+        Record(index);
+        Assign(index, possibilities);
+    }
+
+    void Record(int index)
+    {
+        if (m_Trail)
+            m_Trail->Record(index, m_Possibilities[index]);
+    }
+
+    void Assign(int index, Possibilities const& possibilities);
+
+    bool IsValueSetInUnit(int unit, PossibilitiesBitSet valueBit) const;
+
+    void RebuildUnits();
+
+    void RebuildPossibilitiesCounts();
+    void MoveBetweenPossibilitiesCounts(int index, int previousCount, int count);
+
+    void TouchAllUnits() { m_TouchedUnits.fill((std::uint32_t{1} << m_GridSize) - 1); }
+
+    std::byte* GetStorage() { return m_HeapStorage ? m_HeapStorage.get() : m_InlineStorage; }
+    std::byte const* GetStorage() const { return m_HeapStorage ? m_HeapStorage.get() : m_InlineStorage; }
+
+    // Allocates the storage if the grid size needs it, keeping the storage allocated for the same size
+    void AllocateStorage(int previousGridSize);
+    void PointIntoStorage();
+
+    int m_GridSize;
+    GridUnits const* m_Units;
+    Trail* m_Trail {nullptr};
+
+    // Point into the storage
+    Possibilities* m_Possibilities;
+    // Indexed by unit
+    PossibilitiesBitSet* m_PlacedValues;
+    // Indexed by unit * gridSize + value - 1
+    UnitSlotsBitSet* m_ValueLocations;
+    // GetCellsWordsCount() words per possibilities count, from 0 to gridSize
+    std::uint64_t* m_CellsByPossibilitiesCount;
+
+    GridUnits::UnitsBitSet m_TouchedUnits {};
+
+    int m_UnsetCellsCount;
 
-    const int m_GridSize;
+    std::unique_ptr<std::byte[]> m_HeapStorage;
+    alignas(std::uint64_t) std::byte m_InlineStorage[detail::GetGridStorageSize(InlineGridSize)];
 };
 
+// Every modification of the possibilities goes through here, so that the units stay in sync
+inline void Grid::Assign(int index, Possibilities const& possibilities)
+{
+    const auto previousBitSet = m_Possibilities[index].GetBitSet();
+    const auto wasSet = m_Possibilities[index].OnlyOnePossibilityLeft();
+
+    m_Possibilities[index] = possibilities;
+
+    const auto bitSet = possibilities.GetBitSet();
+    const auto removedValues = previousBitSet & ~bitSet;
+    const auto addedValues = bitSet & ~previousBitSet;
+
+    if ((removedValues | addedValues) != 0)
+    {
+        MoveBetweenPossibilitiesCounts(index, __builtin_popcount(previousBitSet), __builtin_popcount(bitSet));
+        m_UnsetCellsCount += static_cast<int>(wasSet) - static_cast<int>(possibilities.OnlyOnePossibilityLeft());
+    }
+
+    auto const& cellSlots = m_Units->GetCellSlots(index);
+
+    for (int unitKind = 0; unitKind < GridUnits::UnitsPerCell; unitKind++)
+    {
+        const auto [unit, slot] = cellSlots[unitKind];
+
+        if (removedValues != 0)
+            m_TouchedUnits[unitKind] |= std::uint32_t{1} << (unit - unitKind * m_GridSize);
+
+        auto* valueLocations = &m_ValueLocations[unit * m_GridSize];
+        const auto slotBit = UnitSlotsBitSet{1} << slot;
+
+        for (auto values = removedValues; values != 0; values &= values - 1)
+            valueLocations[__builtin_ctz(values)] &= ~slotBit;
+
+        for (auto values = addedValues; values != 0; values &= values - 1)
+            valueLocations[__builtin_ctz(values)] |= slotBit;
+
+        if (wasSet && previousBitSet != bitSet && !IsValueSetInUnit(unit, previousBitSet))
+            m_PlacedValues[unit] &= ~previousBitSet;
+
+        if (possibilities.OnlyOnePossibilityLeft())
+            m_PlacedValues[unit] |= bitSet;
+    }
+}
+
+inline void Grid::MoveBetweenPossibilitiesCounts(int index, int previousCount, int count)
+{
+    if (previousCount == count)
+        return;
+
+    const auto cellsWords = GetCellsWordsCount();
+    const auto word = index / 64;
+    const auto cellBit = std::uint64_t{1} << (index % 64);
+
+    m_CellsByPossibilitiesCount[previousCount * cellsWords + word] &= ~cellBit;
+    m_CellsByPossibilitiesCount[count * cellsWords + word] |= cellBit;
+}
+
+// Only a few words per possibilities count are looked at, instead of every cell
+inline int Grid::GetCellWithFewestPossibilities() const
+{
+    if (m_UnsetCellsCount == 0)
+        return -1;
+
+    const auto cellsWords = GetCellsWordsCount();
+
+    for (int count = 0; count <= m_GridSize; count += count == 0 ? 2 : 1)
+    {
+        const auto* cells = GetCellsWithPossibilitiesCount(count);
+
+        for (int word = 0; word < cellsWords; word++)
+        {
+            if (cells[word] != 0)
+                return word * 64 + __builtin_ctzll(cells[word]);
+        }
+    }
+
+    return -1;
+}
+
+inline bool Grid::IsValueSetInUnit(int unit, PossibilitiesBitSet valueBit) const
+{
+    for (auto slots = m_ValueLocations[unit * m_GridSize + __builtin_ctz(valueBit)]; slots != 0; slots &= slots - 1)
+    {
+        if (m_Possibilities[m_Units->GetCellIndex(unit, __builtin_ctz(slots))].OnlyOnePossibilityLeft())
+            return true;
+    }
+
+    return false;
+}
+
+// On one line, see FormatGrid
 std::ostream& operator<<(std::ostream& os, Grid const& grid);
 
+// Grid drawn with its blocks on several lines, to debug: os << PrettyGrid {grid}
+struct PrettyGrid
+{
+    Grid const& m_Grid;
+};
+
+std::ostream& operator<<(std::ostream& os, PrettyGrid const& prettyGrid);
+
+// Used by gtest to print the grids of the failed expectations
+void PrintTo(Grid const& grid, std::ostream* os);
+
 bool operator==(Grid const& lhs, Grid const& rhs);
 
+// Records the modifications of the grid in trail while in scope
+class ScopedTrail
+{
+public:
+    ScopedTrail(Grid& grid, Trail& trail) :
+        m_Grid(grid),
+        m_PreviousTrail(grid.GetTrail())
+    {
+        m_Grid.SetTrail(&trail);
+    }
+
+    ScopedTrail(ScopedTrail const&) = delete;
+    ScopedTrail& operator=(ScopedTrail const&) = delete;
+
+    ~ScopedTrail() { m_Grid.SetTrail(m_PreviousTrail); }
+
+private:
+    Grid& m_Grid;
+    Trail* const m_PreviousTrail;
+};
+
 } // namespace sudoku
@@ -0,0 +1,242 @@
+#include "GridGenerator.hpp"
+
+#include <algorithm>
+#include <numeric>
+#include <stdexcept>
+
+#include "GridSize.hpp"
+
+using namespace sudoku;
+
+namespace
+{
+
+// Groups of linesPerGroup lines shuffled, then the lines within each group
+std::vector<int> ShuffleLines(std::mt19937_64& random, int gridSize, int linesPerGroup)
+{
+    std::vector<int> groups(gridSize / linesPerGroup);
+    std::iota(groups.begin(), groups.end(), 0);
+    std::shuffle(groups.begin(), groups.end(), random);
+
+    std::vector<int> lines;
+
+    for (auto group : groups)
+    {
+        const auto firstLine = lines.size();
+
+        for (int line = 0; line < linesPerGroup; line++)
+            lines.push_back(group * linesPerGroup + line);
+
+        std::shuffle(lines.begin() + firstLine, lines.end(), random);
+    }
+
+    return lines;
+}
+
+} // anonymous namespace
+
+GridGeneratorImpl::GridGeneratorImpl(
+        std::unique_ptr<SolutionsFinder> solutionsFinder,
+        PuzzleGeneration const& puzzleGeneration) :
+    m_SolutionsFinder(std::move(solutionsFinder)),
+    m_PuzzleGeneration(puzzleGeneration),
+    m_Orbits(detail::GetSymmetryOrbits(puzzleGeneration.m_GridSize, puzzleGeneration.m_Symmetry))
+{
+    // Throws if the size isn't supported
+    VisitGridSize(m_PuzzleGeneration.m_GridSize, [](auto){});
+
+    if (m_PuzzleGeneration.m_CluesCount <= 0)
+        throw std::runtime_error("Grids can't be generated without clues");
+}
+
+std::vector<Grid> GridGeneratorImpl::Generate(int gridsCount, std::uint64_t seed) const
+{
+    std::vector<Grid> puzzles;
+
+    for (int i = 0; i < gridsCount; i++)
+    {
+        std::mt19937_64 random {seed + i};
+        Grid puzzle {m_PuzzleGeneration.m_GridSize};
+
+        if (GenerateOne(random, puzzle))
+            puzzles.push_back(puzzle);
+    }
+
+    return puzzles;
+}
+
+bool GridGeneratorImpl::GenerateOne(std::mt19937_64& random, Grid& puzzle) const
+{
+    Values solution;
+
+    for (int attempt = 0; attempt < m_PuzzleGeneration.m_AttemptsCount; attempt++)
+    {
+        if (MakeSolution(random, solution) && RemoveClues(random, solution, puzzle))
+            return true;
+    }
+
+    return false;
+}
+
+bool GridGeneratorImpl::MakeSolution(std::mt19937_64& random, Values& solution) const
+{
+    const int gridSize = m_PuzzleGeneration.m_GridSize;
+    const int blockRows = GetBlockRows(gridSize);
+    const int blockCols = GetBlockCols(gridSize);
+
+    Grid grid {gridSize};
+
+    Values firstBlockValues(gridSize);
+    std::iota(firstBlockValues.begin(), firstBlockValues.end(), 1);
+    std::shuffle(firstBlockValues.begin(), firstBlockValues.end(), random);
+
+    for (int i = 0; i < gridSize; i++)
+        grid.SetValue(grid.GetIndex(Position {i / blockCols, i % blockCols}), firstBlockValues[i]);
+
+    // The search always completes a first block the same way, the rows of a band and the columns of a stack can be swapped
+    const auto rows = ShuffleLines(random, gridSize, blockRows);
+    const auto cols = ShuffleLines(random, gridSize, blockCols);
+
+    solution.resize(grid.GetCellsCount());
+
+    const auto solutionsCount = m_SolutionsFinder->EnumerateSolutions(grid, [&](Grid const& solvedGrid)
+        {
+            for (int row = 0; row < gridSize; row++)
+            {
+                for (int col = 0; col < gridSize; col++)
+                    solution[row * gridSize + col] = *solvedGrid.GetCell(Position {rows[row], cols[col]}).GetValue();
+            }
+
+            return false;
+        });
+
+    return solutionsCount > 0;
+}
+
+// Most clues can be removed while many are left, so the orbits are removed by chunks checked at once.
+// A chunk without a unique solution is halved until its orbits are checked one by one, and a chunk with one grows,
+// which keeps the clues that one by one removals would.
+// The clues kept are set in a grid as they are decided, only the orbits not examined yet are set in each grid checked.
+bool GridGeneratorImpl::RemoveClues(std::mt19937_64& random, Values const& solution, Grid& puzzle) const
+{
+    auto orbits = m_Orbits;
+    std::shuffle(orbits.begin(), orbits.end(), random);
+
+    Grid keptClues {m_PuzzleGeneration.m_GridSize};
+
+    int cluesCount = solution.size();
+    std::size_t chunkSize = 1;
+    std::size_t firstOrbit = 0;
+
+    while (firstOrbit < orbits.size() && cluesCount > m_PuzzleGeneration.m_CluesCount)
+    {
+        // No more orbits than needed to reach the clues count
+        auto lastOrbit = firstOrbit;
+        int removedCount = 0;
+
+        while (lastOrbit < orbits.size() && lastOrbit - firstOrbit < chunkSize && cluesCount - removedCount > m_PuzzleGeneration.m_CluesCount)
+            removedCount += orbits[lastOrbit++].size();
+
+        auto grid = keptClues;
+        SetClues(solution, orbits, lastOrbit, orbits.size(), grid);
+
+        const bool uniqueSolution = lastOrbit - firstOrbit == 1 ?
+                    HasUniqueSolution(solution, grid, orbits[firstOrbit]) :
+                    m_SolutionsFinder->CountSolutions(grid, 2) == 1;
+
+        if (uniqueSolution)
+        {
+            cluesCount -= removedCount;
+            firstOrbit = lastOrbit;
+            chunkSize *= 2;
+        }
+        else if (lastOrbit - firstOrbit == 1)
+        {
+            SetClues(solution, orbits, firstOrbit, lastOrbit, keptClues);
+            firstOrbit = lastOrbit;
+        }
+        else
+        {
+            chunkSize = (lastOrbit - firstOrbit) / 2;
+        }
+    }
+
+    if (cluesCount > m_PuzzleGeneration.m_CluesCount)
+        return false;
+
+    // The orbits left once the clues count is reached are kept
+    puzzle = keptClues;
+    SetClues(solution, orbits, firstOrbit, orbits.size(), puzzle);
+
+    return true;
+}
+
+// The grid had a unique solution before the orbit was removed, any other solution differs on a cell of the orbit.
+// The cells of the orbit are tried in turn as the first one where it differs, which is faster than counting the solutions
+// up to 2 as the search of the solution known is avoided.
+bool GridGeneratorImpl::HasUniqueSolution(Values const& solution, Grid const& puzzle, Orbit const& removedOrbit) const
+{
+    for (std::size_t differingCell = 0; differingCell < removedOrbit.size(); differingCell++)
+    {
+        auto grid = puzzle;
+
+        for (std::size_t i = 0; i < differingCell; i++)
+            grid.SetValue(removedOrbit[i], solution[removedOrbit[i]]);
+
+        const auto index = removedOrbit[differingCell];
+        grid.RemovePossibility(index, solution[index]);
+
+        if (m_SolutionsFinder->CountSolutions(grid, 1) > 0)
+            return false;
+    }
+
+    return true;
+}
+
+void GridGeneratorImpl::SetClues(Values const& solution, std::vector<Orbit> const& orbits, std::size_t firstOrbit, std::size_t lastOrbit, Grid& grid)
+{
+    for (auto orbit = firstOrbit; orbit < lastOrbit; orbit++)
+    {
+        for (auto index : orbits[orbit])
+            grid.SetValue(index, solution[index]);
+    }
+}
+
+std::vector<std::vector<int>> detail::GetSymmetryOrbits(int gridSize, Symmetry symmetry)
+{
+    auto getSymmetricPosition = [gridSize, symmetry](Position const& position)
+        {
+            switch (symmetry)
+            {
+            case Symmetry::None : return position;
+            case Symmetry::Central : return Position {gridSize - 1 - position.m_Row, gridSize - 1 - position.m_Col};
+            case Symmetry::Diagonal : return Position {position.m_Col, position.m_Row};
+            }
+
+            throw std::runtime_error("Unknown symmetry");
+        };
+
+    std::vector<std::vector<int>> orbits;
+
+    for (int row = 0; row < gridSize; row++)
+    {
+        for (int col = 0; col < gridSize; col++)
+        {
+            const Position position {row, col};
+            const auto symmetricPosition = getSymmetricPosition(position);
+
+            // Each orbit is added from its first cell
+            if (symmetricPosition < position)
+                continue;
+
+            std::vector<int> orbit {row * gridSize + col};
+
+            if (!(symmetricPosition == position))
+                orbit.push_back(symmetricPosition.m_Row * gridSize + symmetricPosition.m_Col);
+
+            orbits.push_back(orbit);
+        }
+    }
+
+    return orbits;
+}
@@ -0,0 +1,82 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "Grid.hpp"
+#include "GridSolverWithHypothesis.hpp"
+
+namespace sudoku
+{
+
+// Cells whose clues are kept or removed together
+enum class Symmetry
+{
+    None,
+    // Half turn around the centre of the grid
+    Central,
+    // Reflection across the diagonal going from the top left corner
+    Diagonal
+};
+
+struct PuzzleGeneration
+{
+    int m_GridSize {9};
+
+    // Grids are generated with at most this number of given cells
+    int m_CluesCount {26};
+
+    Symmetry m_Symmetry {Symmetry::None};
+
+    // Solutions tried for each grid, the clues count can't be reached from most of them when it is low
+    int m_AttemptsCount {20};
+};
+
+class GridGenerator
+{
+public:
+    virtual ~GridGenerator() = default;
+
+    // Grids with a unique solution, the grid of index i only depending on seed + i.
+    // The grids for which the clues count wasn't reached within the attempts are left out.
+    virtual std::vector<Grid> Generate(int gridsCount, std::uint64_t seed) const = 0;
+};
+
+// A random solution is made by solving a grid with a random first block, then by swapping bands, stacks, and rows and columns within them.
+// Its clues are then removed in a random order, a removal being undone if the grid doesn't keep a unique solution.
+// As a grid with more clues has fewer solutions, a clue needed once is needed until the end, so a single pass is done.
+// The solutions finder must not find the solutions of several grids at once.
+class GridGeneratorImpl final : public GridGenerator
+{
+public:
+    GridGeneratorImpl(
+            std::unique_ptr<SolutionsFinder> solutionsFinder,
+            PuzzleGeneration const& puzzleGeneration);
+
+    std::vector<Grid> Generate(int gridsCount, std::uint64_t seed) const override;
+
+private:
+    using Values = std::vector<Value>;
+    using Orbit = std::vector<int>;
+
+    bool GenerateOne(std::mt19937_64& random, Grid& puzzle) const;
+    bool MakeSolution(std::mt19937_64& random, Values& solution) const;
+    bool RemoveClues(std::mt19937_64& random, Values const& solution, Grid& puzzle) const;
+    bool HasUniqueSolution(Values const& solution, Grid const& puzzle, Orbit const& removedOrbit) const;
+
+    static void SetClues(Values const& solution, std::vector<Orbit> const& orbits, std::size_t firstOrbit, std::size_t lastOrbit, Grid& grid);
+
+    std::unique_ptr<SolutionsFinder> m_SolutionsFinder;
+    const PuzzleGeneration m_PuzzleGeneration;
+    // Cells of the grid grouped by symmetry
+    std::vector<Orbit> m_Orbits;
+};
+
+namespace detail
+{
+std::vector<std::vector<int>> GetSymmetryOrbits(int gridSize, Symmetry symmetry);
+} // namespace detail
+
+} /* namespace sudoku */
@@ -3,11 +3,11 @@
 #include <memory>
 
 #include "FoundPositions.hpp"
+#include "RelatedPossibilitiesRemover.hpp"
 
 namespace sudoku
 {
 
-class RelatedPossibilitiesRemover;
 class Grid;
 
 class GridPossibilitiesUpdater
@@ -15,20 +15,43 @@ class GridPossibilitiesUpdater
 public:
     virtual ~GridPossibilitiesUpdater() = default;
 
-    virtual void UpdateGrid(FoundPositions& foundPositions, Grid& grid) = 0;
+    // Returns false if the update leads to a contradiction in the grid
+    virtual bool UpdateGrid(FoundPositions& foundPositions, Grid& grid) = 0;
 };
 
-class GridPossibilitiesUpdaterImpl : public GridPossibilitiesUpdater
+template<typename TRelatedPossibilitiesRemover = RelatedPossibilitiesRemover>
+class GridPossibilitiesUpdaterImpl final : public GridPossibilitiesUpdater
 {
 public:
     GridPossibilitiesUpdaterImpl(
-            std::unique_ptr<RelatedPossibilitiesRemover> relatedPossibilitiesRemover);
+            std::unique_ptr<TRelatedPossibilitiesRemover> relatedPossibilitiesRemover);
 
-    void UpdateGrid(FoundPositions& foundPositions, Grid& grid) override;
+    bool UpdateGrid(FoundPositions& foundPositions, Grid& grid) override;
 
 private:
-    std::unique_ptr<RelatedPossibilitiesRemover> m_RelatedPossibilitiesRemover;
+    std::unique_ptr<TRelatedPossibilitiesRemover> m_RelatedPossibilitiesRemover;
 };
 
+template<typename TRelatedPossibilitiesRemover>
+GridPossibilitiesUpdaterImpl<TRelatedPossibilitiesRemover>::GridPossibilitiesUpdaterImpl(
+        std::unique_ptr<TRelatedPossibilitiesRemover> relatedPossibilitiesRemover) :
+    m_RelatedPossibilitiesRemover(std::move(relatedPossibilitiesRemover))
+{}
+
+template<typename TRelatedPossibilitiesRemover>
+bool GridPossibilitiesUpdaterImpl<TRelatedPossibilitiesRemover>::UpdateGrid(FoundPositions& foundPositions, Grid& grid)
+{
+    while(!foundPositions.empty())
+    {
+        auto newFoundPosition = foundPositions.front();
+        foundPositions.pop();
+
+        if (!m_RelatedPossibilitiesRemover->UpdateRelatedPossibilities(newFoundPosition, grid, foundPositions))
+            return false;
+    }
+
+    return true;
+}
+
 } /* namespace sudoku */
 
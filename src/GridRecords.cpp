@@ -0,0 +1,292 @@
+#include "GridRecords.hpp"
+
+#include <stdexcept>
+#include <string>
+
+#include "GridSize.hpp"
+
+namespace sudoku
+{
+
+namespace
+{
+
+constexpr char Magic[] {'S', 'D', 'K', 'R'};
+
+// The buffer of a writer is written to the output once that large
+constexpr std::size_t WriterBufferSize {64 * 1024};
+
+int GetValueBits(int gridSize)
+{
+    return 32 - __builtin_clz(gridSize);
+}
+
+std::size_t GetCellsMaskSize(int gridSize)
+{
+    return (gridSize * gridSize + 7) / 8;
+}
+
+// Appends values of bitsCount bits, least significant bits first
+class BitsWriter
+{
+public:
+    BitsWriter(std::vector<std::uint8_t>& buffer) : m_Buffer(buffer) {}
+
+    ~BitsWriter()
+    {
+        if (m_BitsCount > 0)
+            m_Buffer.push_back(m_Bits);
+    }
+
+    void Write(std::uint32_t value, int bitsCount)
+    {
+        m_Bits |= value << m_BitsCount;
+        m_BitsCount += bitsCount;
+
+        while (m_BitsCount >= 8)
+        {
+            m_Buffer.push_back(m_Bits & 0xFF);
+            m_Bits >>= 8;
+            m_BitsCount -= 8;
+        }
+    }
+
+private:
+    std::vector<std::uint8_t>& m_Buffer;
+    std::uint32_t m_Bits {0};
+    int m_BitsCount {0};
+};
+
+// Reads values written by a BitsWriter, the data must hold all the bits read
+class BitsReader
+{
+public:
+    BitsReader(char const* data) : m_Data(reinterpret_cast<std::uint8_t const*>(data)) {}
+
+    std::uint32_t Read(int bitsCount)
+    {
+        while (m_BitsCount < bitsCount)
+        {
+            m_Bits |= std::uint32_t{*m_Data++} << m_BitsCount;
+            m_BitsCount += 8;
+        }
+
+        const auto value = m_Bits & ((std::uint32_t{1} << bitsCount) - 1);
+        m_Bits >>= bitsCount;
+        m_BitsCount -= bitsCount;
+
+        return value;
+    }
+
+    // Bytes started, the next record starts after them
+    std::size_t GetBytesRead(char const* data) const { return reinterpret_cast<char const*>(m_Data) - data; }
+
+private:
+    std::uint8_t const* m_Data;
+    std::uint32_t m_Bits {0};
+    int m_BitsCount {0};
+};
+
+void SetValue(Grid& grid, int index, std::uint32_t value)
+{
+    if (value == 0 || static_cast<int>(value) > grid.GetGridSize())
+        throw std::runtime_error("Invalid value '" + std::to_string(value) + "' in a grid record");
+
+    grid.SetValue(index, value);
+}
+
+std::uint32_t GetValue(Grid const& grid, int index)
+{
+    auto const& possibilities = grid.GetPossibilities(index);
+
+    return possibilities.OnlyOnePossibilityLeft() ? possibilities.GetPossibilityLeft() : 0;
+}
+
+} // anonymous namespace
+
+std::size_t GetGridRecordSize(int gridSize)
+{
+    return (gridSize * gridSize * GetValueBits(gridSize) + 7) / 8;
+}
+
+GridRecordsWriter::GridRecordsWriter(std::ostream& output, GridRecordsKind kind, int gridSize) :
+    m_Output(output),
+    m_Header{GridRecordsVersion, kind, gridSize}
+{
+    // Throws if the size isn't supported
+    VisitGridSize(gridSize, [](auto){});
+
+    m_Buffer.reserve(WriterBufferSize + GetCellsMaskSize(gridSize) + GetGridRecordSize(gridSize));
+
+    m_Buffer.insert(m_Buffer.end(), std::begin(Magic), std::end(Magic));
+    m_Buffer.push_back(m_Header.m_Version);
+    m_Buffer.push_back(static_cast<std::uint8_t>(m_Header.m_Kind));
+    m_Buffer.push_back(m_Header.m_GridSize);
+    m_Buffer.push_back(0);
+}
+
+GridRecordsWriter::~GridRecordsWriter()
+{
+    Flush();
+}
+
+void GridRecordsWriter::Write(Grid const& grid)
+{
+    CheckGrid(grid, GridRecordsKind::Grids);
+
+    const auto valueBits = GetValueBits(m_Header.m_GridSize);
+
+    {
+        BitsWriter bitsWriter {m_Buffer};
+
+        for (int index = 0; index < grid.GetCellsCount(); index++)
+            bitsWriter.Write(GetValue(grid, index), valueBits);
+    }
+
+    if (m_Buffer.size() >= WriterBufferSize)
+        Flush();
+}
+
+void GridRecordsWriter::Write(Grid const& grid, Grid const& solution)
+{
+    CheckGrid(grid, GridRecordsKind::SolutionsOfGrids);
+    CheckGrid(solution, GridRecordsKind::SolutionsOfGrids);
+
+    const auto valueBits = GetValueBits(m_Header.m_GridSize);
+
+    {
+        BitsWriter bitsWriter {m_Buffer};
+
+        for (int index = 0; index < grid.GetCellsCount(); index++)
+            bitsWriter.Write(GetValue(grid, index) != 0, 1);
+    }
+
+    {
+        BitsWriter bitsWriter {m_Buffer};
+
+        for (int index = 0; index < grid.GetCellsCount(); index++)
+        {
+            if (GetValue(grid, index) == 0)
+                bitsWriter.Write(GetValue(solution, index), valueBits);
+        }
+    }
+
+    if (m_Buffer.size() >= WriterBufferSize)
+        Flush();
+}
+
+void GridRecordsWriter::Flush()
+{
+    m_Output.write(reinterpret_cast<char const*>(m_Buffer.data()), m_Buffer.size());
+    m_Buffer.clear();
+}
+
+void GridRecordsWriter::CheckGrid(Grid const& grid, GridRecordsKind kind) const
+{
+    if (m_Header.m_Kind != kind)
+        throw std::runtime_error("Record of the wrong kind for the grid records file");
+
+    if (grid.GetGridSize() != m_Header.m_GridSize)
+        throw std::runtime_error("Grid of size '" + std::to_string(grid.GetGridSize()) + "' in a file of grids of size '"
+                                 + std::to_string(m_Header.m_GridSize) + "'");
+}
+
+GridRecordsReader::GridRecordsReader(std::string_view data) :
+    m_Data(data)
+{
+    if (m_Data.size() < GridRecordsHeaderSize || m_Data.substr(0, sizeof(Magic)) != std::string_view(Magic, sizeof(Magic)))
+        throw std::runtime_error("Not a grid records file");
+
+    m_Header.m_Version = static_cast<std::uint8_t>(m_Data[4]);
+    m_Header.m_Kind = static_cast<GridRecordsKind>(m_Data[5]);
+    m_Header.m_GridSize = static_cast<std::uint8_t>(m_Data[6]);
+
+    if (m_Header.m_Version != GridRecordsVersion)
+        throw std::runtime_error("Unsupported grid records version '" + std::to_string(m_Header.m_Version) + "'");
+
+    if (m_Header.m_Kind != GridRecordsKind::Grids && m_Header.m_Kind != GridRecordsKind::SolutionsOfGrids)
+        throw std::runtime_error("Unknown grid records kind");
+
+    // Throws if the size isn't supported
+    VisitGridSize(m_Header.m_GridSize, [](auto){});
+
+    m_Data.remove_prefix(GridRecordsHeaderSize);
+}
+
+Grid GridRecordsReader::Read()
+{
+    CheckKind(GridRecordsKind::Grids);
+
+    const auto recordSize = GetGridRecordSize(m_Header.m_GridSize);
+
+    if (m_Data.size() < recordSize)
+        throw std::runtime_error("Truncated grid record");
+
+    const auto valueBits = GetValueBits(m_Header.m_GridSize);
+
+    Grid grid {m_Header.m_GridSize};
+    BitsReader bitsReader {m_Data.data()};
+
+    // Only the given cells are updated in the empty grid
+    for (int index = 0; index < grid.GetCellsCount(); index++)
+    {
+        if (const auto value = bitsReader.Read(valueBits))
+            SetValue(grid, index, value);
+    }
+
+    m_Data.remove_prefix(recordSize);
+
+    return grid;
+}
+
+Grid GridRecordsReader::Read(Grid const& grid)
+{
+    CheckKind(GridRecordsKind::SolutionsOfGrids);
+
+    if (grid.GetGridSize() != m_Header.m_GridSize)
+        throw std::runtime_error("No solution of a grid of size '" + std::to_string(grid.GetGridSize()) + "' in the grid records file");
+
+    const auto maskSize = GetCellsMaskSize(m_Header.m_GridSize);
+
+    if (m_Data.size() < maskSize)
+        throw std::runtime_error("Truncated grid record");
+
+    BitsReader maskReader {m_Data.data()};
+    m_Data.remove_prefix(maskSize);
+
+    Grid solution {grid};
+
+    const auto valueBits = GetValueBits(m_Header.m_GridSize);
+    const std::size_t valuesSize = (solution.GetUnsetCellsCount() * valueBits + 7) / 8;
+
+    if (m_Data.size() < valuesSize)
+        throw std::runtime_error("Truncated grid record");
+
+    BitsReader valuesReader {m_Data.data()};
+
+    for (int index = 0; index < solution.GetCellsCount(); index++)
+    {
+        const bool given = maskReader.Read(1);
+
+        if (given != (GetValue(grid, index) != 0))
+            throw std::runtime_error("Solution record of another grid");
+
+        if (!given)
+            SetValue(solution, index, valuesReader.Read(valueBits));
+    }
+
+    m_Data.remove_prefix(valuesSize);
+
+    return solution;
+}
+
+void GridRecordsReader::CheckKind(GridRecordsKind kind) const
+{
+    if (m_Header.m_Kind != kind)
+        throw std::runtime_error("Record of the wrong kind for the grid records file");
+
+    if (IsOver())
+        throw std::runtime_error("No grid record left");
+}
+
+} // namespace sudoku
@@ -0,0 +1,91 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <string_view>
+#include <vector>
+
+#include "Grid.hpp"
+
+namespace sudoku
+{
+
+// Binary files of grids of the same size: a header, then one record per grid, each record starting on a new byte.
+// Values are packed on the fewest bits holding the grid size (4 bits for 9x9 grids, 5 bits for 16x16 and 25x25 grids),
+// 0 for the empty cells.
+enum class GridRecordsKind : std::uint8_t
+{
+    // Fixed size records of all the cells, the empty ones included. Used for the grids to solve and for their solutions.
+    Grids,
+    // Solutions of the grids of a Grids file, in the same order: a bit per cell, set for the cells given in the grid,
+    // then the values of the other cells only. The size of a record depends on the number of cells given.
+    SolutionsOfGrids
+};
+
+struct GridRecordsHeader
+{
+    int m_Version;
+    GridRecordsKind m_Kind;
+    int m_GridSize;
+};
+
+inline constexpr int GridRecordsVersion {1};
+
+// Magic number, version, kind, grid size, padding
+inline constexpr std::size_t GridRecordsHeaderSize {8};
+
+std::size_t GetGridRecordSize(int gridSize);
+
+// Records are written to a buffer, which is written to the output once large enough, or when flushed.
+class GridRecordsWriter
+{
+public:
+    GridRecordsWriter(std::ostream& output, GridRecordsKind kind, int gridSize);
+    ~GridRecordsWriter();
+
+    GridRecordsWriter(GridRecordsWriter const&) = delete;
+    GridRecordsWriter& operator=(GridRecordsWriter const&) = delete;
+
+    // For a Grids file
+    void Write(Grid const& grid);
+
+    // For a SolutionsOfGrids file, solution must be the solution of grid
+    void Write(Grid const& grid, Grid const& solution);
+
+    void Flush();
+
+private:
+    void CheckGrid(Grid const& grid, GridRecordsKind kind) const;
+
+    std::ostream& m_Output;
+    const GridRecordsHeader m_Header;
+
+    std::vector<std::uint8_t> m_Buffer;
+};
+
+// Reads the records of a file in memory, such as a MappedFile, decoding them straight into grids.
+// Throws if the data isn't a grid records file of a supported version, or if a record is truncated or invalid.
+class GridRecordsReader
+{
+public:
+    GridRecordsReader(std::string_view data);
+
+    GridRecordsHeader const& GetHeader() const { return m_Header; }
+
+    bool IsOver() const { return m_Data.empty(); }
+
+    // For a Grids file
+    Grid Read();
+
+    // For a SolutionsOfGrids file, returns the solution of grid
+    Grid Read(Grid const& grid);
+
+private:
+    void CheckKind(GridRecordsKind kind) const;
+
+    std::string_view m_Data;
+    GridRecordsHeader m_Header;
+};
+
+} // namespace sudoku
@@ -0,0 +1,106 @@
+#pragma once
+
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+namespace sudoku
+{
+
+using SupportedGridSizes = std::integer_sequence<int, 4, 6, 9, 16, 25>;
+
+template<int TGridSize>
+using GridSizeConstant = std::integral_constant<int, TGridSize>;
+
+constexpr int isqrt_impl(int sq, int dlt, int value)
+{
+    return sq <= value ? isqrt_impl(sq+dlt, dlt+2, value) : (dlt >> 1) - 1;
+}
+
+constexpr int isqrt(int value)
+{
+    return isqrt_impl(1, 3, value);
+}
+
+// Blocks are as square as possible: 9 -> 3x3, 6 -> 2x3, 12 -> 3x4
+constexpr int GetBlockRows(int gridSize)
+{
+    int rows = isqrt(gridSize);
+
+    while (gridSize % rows != 0)
+        rows--;
+
+    return rows;
+}
+
+constexpr int GetBlockCols(int gridSize)
+{
+    return gridSize / GetBlockRows(gridSize);
+}
+
+constexpr bool HasValidBlocks(int gridSize)
+{
+    return gridSize > 1 && GetBlockRows(gridSize) > 1;
+}
+
+constexpr int GetCellsNumberInGrid(int gridSize)
+{
+    return gridSize * gridSize;
+}
+
+constexpr int GetGroupsNumberInGrid(int gridSize)
+{
+    constexpr int groupType {3};
+    return gridSize * groupType;
+}
+
+constexpr int GetNumberOfRelatedPositionInGroup(int gridSize)
+{
+    return gridSize - 1;
+}
+
+constexpr int GetAllRelatedPositionNumber(int gridSize)
+{
+    // row + col + block cells not already on the row or col
+    return 3 * gridSize - GetBlockRows(gridSize) - GetBlockCols(gridSize) - 1;
+}
+
+namespace detail
+{
+
+template<typename TFunction, int TGridSize, int... TOtherGridSizes>
+decltype(auto) VisitGridSizeImpl(int gridSize, TFunction& function, std::integer_sequence<int, TGridSize, TOtherGridSizes...>)
+{
+    if (gridSize == TGridSize)
+        return function(GridSizeConstant<TGridSize>{});
+
+    if constexpr (sizeof...(TOtherGridSizes) == 0)
+        throw std::runtime_error("Unsupported grid size '" + std::to_string(gridSize) + "'");
+    else
+        return VisitGridSizeImpl(gridSize, function, std::integer_sequence<int, TOtherGridSizes...>{});
+}
+
+template<typename TFunction, int... TGridSizes>
+void ForEachGridSizeImpl(TFunction& function, std::integer_sequence<int, TGridSizes...>)
+{
+    (function(GridSizeConstant<TGridSizes>{}), ...);
+}
+
+} // namespace detail
+
+// Call function with the compile time constant matching the runtime grid size
+template<typename TFunction>
+decltype(auto) VisitGridSize(int gridSize, TFunction&& function)
+{
+    return detail::VisitGridSizeImpl(gridSize, function, SupportedGridSizes{});
+}
+
+// Call function with the compile time constant of every supported grid size
+template<typename TFunction>
+void ForEachGridSize(TFunction&& function)
+{
+    detail::ForEachGridSizeImpl(function, SupportedGridSizes{});
+}
+
+} // namespace sudoku
@@ -0,0 +1,45 @@
+#include "GridSolverDispatcher.hpp"
+
+#include "Grid.hpp"
+
+using namespace sudoku;
+
+GridSolverDispatcherImpl::GridSolverDispatcherImpl(
+        std::unordered_map<int, std::unique_ptr<GridSolver>> gridSolvers) :
+    m_GridSolvers(std::move(gridSolvers))
+{}
+
+bool GridSolverDispatcherImpl::Solve(Grid& grid) const
+{
+    const auto gridSolver = m_GridSolvers.find(grid.GetGridSize());
+
+    if (gridSolver == m_GridSolvers.end())
+        throw std::runtime_error("No solver for grid size '" + std::to_string(grid.GetGridSize()) + "'");
+
+    return gridSolver->second->Solve(grid);
+}
+
+SolutionsFinderDispatcherImpl::SolutionsFinderDispatcherImpl(
+        std::unordered_map<int, std::unique_ptr<SolutionsFinder>> solutionsFinders) :
+    m_SolutionsFinders(std::move(solutionsFinders))
+{}
+
+int SolutionsFinderDispatcherImpl::CountSolutions(Grid const& grid, int limit) const
+{
+    return GetSolutionsFinder(grid).CountSolutions(grid, limit);
+}
+
+std::int64_t SolutionsFinderDispatcherImpl::EnumerateSolutions(Grid const& grid, SolutionVisitor const& visitor) const
+{
+    return GetSolutionsFinder(grid).EnumerateSolutions(grid, visitor);
+}
+
+SolutionsFinder const& SolutionsFinderDispatcherImpl::GetSolutionsFinder(Grid const& grid) const
+{
+    const auto solutionsFinder = m_SolutionsFinders.find(grid.GetGridSize());
+
+    if (solutionsFinder == m_SolutionsFinders.end())
+        throw std::runtime_error("No solutions finder for grid size '" + std::to_string(grid.GetGridSize()) + "'");
+
+    return *solutionsFinder->second;
+}
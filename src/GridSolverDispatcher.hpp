@@ -0,0 +1,41 @@
+#pragma once
+
+#include <memory>
+#include <unordered_map>
+
+#include "GridSolverWithHypothesis.hpp"
+
+namespace sudoku
+{
+
+class Grid;
+
+class GridSolverDispatcherImpl : public GridSolver
+{
+public:
+    GridSolverDispatcherImpl(
+            std::unordered_map<int, std::unique_ptr<GridSolver>> gridSolvers);
+
+    bool Solve(Grid& grid) const override;
+
+private:
+    std::unordered_map<int, std::unique_ptr<GridSolver>> m_GridSolvers;
+};
+
+class SolutionsFinderDispatcherImpl : public SolutionsFinder
+{
+public:
+    SolutionsFinderDispatcherImpl(
+            std::unordered_map<int, std::unique_ptr<SolutionsFinder>> solutionsFinders);
+
+    int CountSolutions(Grid const& grid, int limit) const override;
+    std::int64_t EnumerateSolutions(Grid const& grid, SolutionVisitor const& visitor) const override;
+
+private:
+    SolutionsFinder const& GetSolutionsFinder(Grid const& grid) const;
+
+    std::unordered_map<int, std::unique_ptr<SolutionsFinder>> m_SolutionsFinders;
+};
+
+} /* namespace sudoku */
+
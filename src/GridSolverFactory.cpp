@@ -1,21 +1,231 @@
 #include "GridSolverFactory.hpp"
 
+#include "DancingLinksGridSolver.hpp"
+#include "DigitPlanesGridSolver.hpp"
+#include "GridSolverDispatcher.hpp"
+#include "ParallelGridGenerator.hpp"
 #include "GridSolverWithoutHypothesis.hpp"
 #include "GridPossibilitiesUpdater.hpp"
 #include "UniquePossibilitySetter.hpp"
 #include "RelatedPossibilitiesRemover.hpp"
+#include "PatternPossibilitiesRemover.hpp"
+#include "GridSize.hpp"
+
+#include <algorithm>
+#include <thread>
 
 using namespace sudoku;
 
-std::unique_ptr<GridSolver> GridSolverFactory::Make()
+namespace
+{
+
+template<int TGridSize>
+using StaticGridPossibilitiesUpdater = GridPossibilitiesUpdaterImpl<RelatedPossibilitiesRemoverImpl<TGridSize>>;
+
+template<int TGridSize>
+using StaticGridSolverWithoutHypothesis = GridSolverWithoutHypothesisImpl<
+        StaticGridPossibilitiesUpdater<TGridSize>, UniquePossibilitySetterImpl<TGridSize>, PatternPossibilitiesRemoverImpl<TGridSize>>;
+
+template<int TGridSize>
+using StaticGridSolver = GridSolverWithHypothesisImpl<StaticGridSolverWithoutHypothesis<TGridSize>>;
+
+template<int TGridSize>
+using StaticParallelGridSolver = ParallelGridSolverWithHypothesisImpl<StaticGridSolverWithoutHypothesis<TGridSize>>;
+
+template<int TGridSize>
+std::unique_ptr<StaticGridSolverWithoutHypothesis<TGridSize>> MakeStaticGridSolverWithoutHypothesis(Deductions const& deductions)
+{
+    return std::make_unique<StaticGridSolverWithoutHypothesis<TGridSize>>
+        (
+            std::make_unique<StaticGridPossibilitiesUpdater<TGridSize>>(
+                std::make_unique<RelatedPossibilitiesRemoverImpl<TGridSize>>()
+            ),
+            std::make_unique<UniquePossibilitySetterImpl<TGridSize>>(),
+            std::make_unique<PatternPossibilitiesRemoverImpl<TGridSize>>(deductions)
+        );
+}
+
+int GetThreadsCount(int threadsCount)
+{
+    return threadsCount > 0 ? threadsCount : std::max(1u, std::thread::hardware_concurrency());
+}
+
+} // anonymous namespace
+
+std::unique_ptr<GridSolver> GridSolverFactory::Make(SolverEngine engine, Deductions const& deductions, Branching branching)
+{
+    std::unordered_map<int, std::unique_ptr<GridSolver>> gridSolvers;
+
+    ForEachGridSize([&gridSolvers, engine, &deductions, branching](auto gridSize)
+        {
+            gridSolvers.emplace(gridSize, Make<decltype(gridSize)::value>(engine, deductions, branching));
+        });
+
+    return std::make_unique<GridSolverDispatcherImpl>(std::move(gridSolvers));
+}
+
+std::unique_ptr<GridSolver> GridSolverFactory::MakeParallel(ParallelSearch const& parallelSearch, Deductions const& deductions, Branching branching)
 {
-    return std::make_unique<GridSolverWithHypothesisImpl>(
-                std::make_unique<GridSolverWithoutHypothesisImpl>
+    auto threadPool = std::make_shared<ThreadPool>(GetThreadsCount(parallelSearch.m_ThreadsCount));
+
+    auto unprofiledDeductions = deductions;
+    unprofiledDeductions.m_Profile = nullptr;
+
+    std::unordered_map<int, std::unique_ptr<GridSolver>> gridSolvers;
+
+    ForEachGridSize([&](auto gridSize)
+        {
+            constexpr int size = decltype(gridSize)::value;
+
+            gridSolvers.emplace(size, std::make_unique<StaticParallelGridSolver<size>>(
+                                    MakeStaticGridSolverWithoutHypothesis<size>(unprofiledDeductions),
+                                    MakeBranchingStrategy(branching),
+                                    threadPool,
+                                    parallelSearch));
+        });
+
+    return std::make_unique<GridSolverDispatcherImpl>(std::move(gridSolvers));
+}
+
+std::unique_ptr<SolutionsFinder> GridSolverFactory::MakeSolutionsFinder(SolverEngine engine, Deductions const& deductions, Branching branching)
+{
+    if (engine == SolverEngine::DancingLinks)
+        throw std::runtime_error("The DancingLinks engine only finds the first solution");
+
+    std::unordered_map<int, std::unique_ptr<SolutionsFinder>> solutionsFinders;
+
+    ForEachGridSize([&](auto gridSize)
+        {
+            constexpr int size = decltype(gridSize)::value;
+
+            if (engine == SolverEngine::DigitPlanes)
+            {
+                solutionsFinders.emplace(size, std::make_unique<DigitPlanesGridSolverImpl<size>>());
+                return;
+            }
+
+            solutionsFinders.emplace(size, std::make_unique<StaticGridSolver<size>>(
+                                         MakeStaticGridSolverWithoutHypothesis<size>(deductions),
+                                         MakeBranchingStrategy(branching)));
+        });
+
+    return std::make_unique<SolutionsFinderDispatcherImpl>(std::move(solutionsFinders));
+}
+
+std::unique_ptr<SolutionsFinder> GridSolverFactory::MakeParallelSolutionsFinder(ParallelSearch const& parallelSearch, Deductions const& deductions, Branching branching)
+{
+    auto threadPool = std::make_shared<ThreadPool>(GetThreadsCount(parallelSearch.m_ThreadsCount));
+
+    auto unprofiledDeductions = deductions;
+    unprofiledDeductions.m_Profile = nullptr;
+
+    std::unordered_map<int, std::unique_ptr<SolutionsFinder>> solutionsFinders;
+
+    ForEachGridSize([&](auto gridSize)
+        {
+            constexpr int size = decltype(gridSize)::value;
+
+            solutionsFinders.emplace(size, std::make_unique<StaticParallelGridSolver<size>>(
+                                         MakeStaticGridSolverWithoutHypothesis<size>(unprofiledDeductions),
+                                         MakeBranchingStrategy(branching),
+                                         threadPool,
+                                         parallelSearch));
+        });
+
+    return std::make_unique<SolutionsFinderDispatcherImpl>(std::move(solutionsFinders));
+}
+
+std::unique_ptr<BatchGridSolver> GridSolverFactory::MakeBatch()
+{
+    return std::make_unique<BatchGridSolverImpl<>>(Make());
+}
+
+std::unique_ptr<BatchGridSolver> GridSolverFactory::MakeParallelBatch(int threadsCount)
+{
+    auto threadPool = std::make_shared<ThreadPool>(GetThreadsCount(threadsCount));
+
+    std::vector<std::unique_ptr<BatchGridSolver>> batchGridSolvers;
+
+    for (int i = 0; i <= threadPool->GetThreadsCount(); i++)
+        batchGridSolvers.push_back(MakeBatch());
+
+    return std::make_unique<ParallelBatchGridSolverImpl>(std::move(batchGridSolvers), std::move(threadPool));
+}
+
+std::unique_ptr<StreamGridSolver> GridSolverFactory::MakeStream(int threadsCount)
+{
+    std::vector<std::unique_ptr<GridSolver>> gridSolvers;
+
+    for (int i = 0; i < GetThreadsCount(threadsCount); i++)
+        gridSolvers.push_back(Make());
+
+    return std::make_unique<StreamGridSolverImpl>(std::move(gridSolvers));
+}
+
+std::unique_ptr<GridGenerator> GridSolverFactory::MakeGenerator(PuzzleGeneration const& puzzleGeneration, int threadsCount, SolverEngine engine)
+{
+    auto threadPool = std::make_shared<ThreadPool>(GetThreadsCount(threadsCount));
+
+    std::vector<std::unique_ptr<GridGenerator>> gridGenerators;
+
+    for (int i = 0; i <= threadPool->GetThreadsCount(); i++)
+        gridGenerators.push_back(std::make_unique<GridGeneratorImpl>(MakeSolutionsFinder(engine), puzzleGeneration));
+
+    return std::make_unique<ParallelGridGeneratorImpl>(std::move(gridGenerators), std::move(threadPool));
+}
+
+std::unique_ptr<BranchingStrategy> GridSolverFactory::MakeBranchingStrategy(Branching branching)
+{
+    switch (branching)
+    {
+    case Branching::FewestPossibilities : return std::make_unique<FewestPossibilitiesBranchingImpl>();
+    case Branching::LeastConstrainingValue : return std::make_unique<LeastConstrainingValueBranchingImpl>();
+    case Branching::MostConstrainedUnits : return std::make_unique<MostConstrainedUnitsBranchingImpl>();
+    case Branching::UnitCells : return std::make_unique<UnitCellsBranchingImpl>();
+    }
+
+    throw std::runtime_error("Unknown branching");
+}
+
+template<int TGridSize>
+std::unique_ptr<GridSolver> GridSolverFactory::Make(SolverEngine engine, Deductions const& deductions, Branching branching)
+{
+    if (engine == SolverEngine::DigitPlanes)
+        return std::make_unique<DigitPlanesGridSolverImpl<TGridSize>>();
+
+    if (engine == SolverEngine::DancingLinks)
+        return std::make_unique<DancingLinksGridSolverImpl<TGridSize>>();
+
+    return std::make_unique<StaticGridSolver<TGridSize>>(
+                MakeStaticGridSolverWithoutHypothesis<TGridSize>(deductions),
+                MakeBranchingStrategy(branching)
+            );
+}
+
+template<int TGridSize>
+std::unique_ptr<GridSolver> GridSolverFactory::MakeDynamicallyComposed(Deductions const& deductions, Branching branching)
+{
+    return std::make_unique<GridSolverWithHypothesisImpl<>>(
+                std::make_unique<GridSolverWithoutHypothesisImpl<>>
                 (
-                    std::make_unique<GridPossibilitiesUpdaterImpl>(
-                        std::make_unique<RelatedPossibilitiesRemoverImpl>()
+                    std::make_unique<GridPossibilitiesUpdaterImpl<>>(
+                        std::make_unique<RelatedPossibilitiesRemoverImpl<TGridSize>>()
                     ),
-                    std::make_unique<UniquePossibilitySetterImpl>()
-                )
+                    std::make_unique<UniquePossibilitySetterImpl<TGridSize>>(),
+                    std::make_unique<PatternPossibilitiesRemoverImpl<TGridSize>>(deductions)
+                ),
+                MakeBranchingStrategy(branching)
             );
 }
+
+template std::unique_ptr<GridSolver> GridSolverFactory::Make<4>(SolverEngine, Deductions const&, Branching);
+template std::unique_ptr<GridSolver> GridSolverFactory::Make<6>(SolverEngine, Deductions const&, Branching);
+template std::unique_ptr<GridSolver> GridSolverFactory::Make<9>(SolverEngine, Deductions const&, Branching);
+template std::unique_ptr<GridSolver> GridSolverFactory::Make<16>(SolverEngine, Deductions const&, Branching);
+template std::unique_ptr<GridSolver> GridSolverFactory::Make<25>(SolverEngine, Deductions const&, Branching);
+
+template std::unique_ptr<GridSolver> GridSolverFactory::MakeDynamicallyComposed<4>(Deductions const&, Branching);
+template std::unique_ptr<GridSolver> GridSolverFactory::MakeDynamicallyComposed<6>(Deductions const&, Branching);
+template std::unique_ptr<GridSolver> GridSolverFactory::MakeDynamicallyComposed<9>(Deductions const&, Branching);
+template std::unique_ptr<GridSolver> GridSolverFactory::MakeDynamicallyComposed<16>(Deductions const&, Branching);
+template std::unique_ptr<GridSolver> GridSolverFactory::MakeDynamicallyComposed<25>(Deductions const&, Branching);
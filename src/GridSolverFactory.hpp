@@ -1,14 +1,77 @@
 #pragma once
 
+#include "BatchGridSolver.hpp"
+#include "BranchingStrategy.hpp"
+#include "Deductions.hpp"
+#include "GridGenerator.hpp"
 #include "GridSolverWithHypothesis.hpp"
+#include "ParallelBatchGridSolver.hpp"
+#include "ParallelGridSolverWithHypothesis.hpp"
+#include "StreamGridSolver.hpp"
 
 namespace sudoku
 {
 
+enum class SolverEngine
+{
+    // Possibilities of each cell stored in the grid, see Grid
+    Cells,
+    // For each value, the cells where it can still go, see DigitPlanesGridSolverImpl
+    DigitPlanes,
+    // Exact cover of the cells and of the values of the units, see DancingLinksGridSolverImpl
+    DancingLinks
+};
+
 class GridSolverFactory
 {
 public:
-    static std::unique_ptr<GridSolver> Make();
+    // Solver dispatching every grid to the solver specialised for its size.
+    // The deductions and the branching are only used by the Cells engine.
+    static std::unique_ptr<GridSolver> Make(SolverEngine engine = SolverEngine::Cells, Deductions const& deductions = {},
+                                            Branching branching = Branching::FewestPossibilities);
+
+    // Solver specialised for grids of size TGridSize, composed statically
+    template<int TGridSize>
+    static std::unique_ptr<GridSolver> Make(SolverEngine engine = SolverEngine::Cells, Deductions const& deductions = {},
+                                            Branching branching = Branching::FewestPossibilities);
+
+    // Same solver composed through the virtual interfaces, as in the unit tests
+    template<int TGridSize>
+    static std::unique_ptr<GridSolver> MakeDynamicallyComposed(Deductions const& deductions = {},
+                                                               Branching branching = Branching::FewestPossibilities);
+
+    // Cells engine searching the hypotheses of a grid on a thread pool shared by the solvers of all the sizes.
+    // The deductions are not profiled.
+    static std::unique_ptr<GridSolver> MakeParallel(ParallelSearch const& parallelSearch, Deductions const& deductions = {},
+                                                    Branching branching = Branching::FewestPossibilities);
+
+    // Finder of the solutions of the grids of every size, with the Cells or the DigitPlanes engine.
+    // The deductions and the branching are only used by the Cells engine.
+    static std::unique_ptr<SolutionsFinder> MakeSolutionsFinder(SolverEngine engine = SolverEngine::Cells, Deductions const& deductions = {},
+                                                                Branching branching = Branching::FewestPossibilities);
+
+    // Cells engine, the top of the hypotheses tree split into subtrees searched on a thread pool
+    static std::unique_ptr<SolutionsFinder> MakeParallelSolutionsFinder(ParallelSearch const& parallelSearch, Deductions const& deductions = {},
+                                                                        Branching branching = Branching::FewestPossibilities);
+
+    // Generator of grids with a unique solution on threadsCount threads, the number of hardware threads when 0.
+    // Every thread has its own generator, checking the grids with MakeSolutionsFinder(engine):
+    // the DigitPlanes engine is the fastest on the grids with many clues checked first.
+    static std::unique_ptr<GridGenerator> MakeGenerator(PuzzleGeneration const& puzzleGeneration, int threadsCount = 0,
+                                                        SolverEngine engine = SolverEngine::DigitPlanes);
+
+    static std::unique_ptr<BranchingStrategy> MakeBranchingStrategy(Branching branching);
+
+    // Solver of many grids at once, the grids which need a hypothesis go to the solver from Make()
+    static std::unique_ptr<BatchGridSolver> MakeBatch();
+
+    // Solver of many grids at once on threadsCount threads, the number of hardware threads when 0.
+    // Every thread has its own solver from MakeBatch().
+    static std::unique_ptr<BatchGridSolver> MakeParallelBatch(int threadsCount = 0);
+
+    // Solver of the grids read from a stream on threadsCount solver threads, the number of hardware threads when 0.
+    // Every thread has its own solver from Make().
+    static std::unique_ptr<StreamGridSolver> MakeStream(int threadsCount = 0);
 };
 
 } /* namespace sudoku */
@@ -1,14 +1,8 @@
 #include "GridSolverWithHypothesis.hpp"
 
-#include "GridSolverWithoutHypothesis.hpp"
-#include "GridStatus.hpp"
-#include "Grid.hpp"
-
-#include <limits>
-
-using namespace sudoku;
-
-namespace
+namespace sudoku
+{
+namespace detail
 {
 
 void GetFoundPositions(Grid const& grid, FoundPositions& foundPositions)
@@ -20,100 +14,24 @@ void GetFoundPositions(Grid const& grid, FoundPositions& foundPositions)
     }
 }
 
-Position SelectBestPositionForHypothesis(Grid const& grid)
-{
-    int minimumNumberPossibilities = std::numeric_limits<int>::max();
-    Position bestPosition;
-
-    for (auto const& cell : grid)
-    {
-        const auto possibilitiesCount = cell.GetNumberPossibilitiesLeft();
-
-        if (possibilitiesCount == 1)
-            continue;
-
-        if (possibilitiesCount < minimumNumberPossibilities)
-        {
-            minimumNumberPossibilities = possibilitiesCount;
-            bestPosition = cell.GetPosition();
-        }
-    }
-
-    if (minimumNumberPossibilities == std::numeric_limits<int>::max())
-        throw std::runtime_error("Can't find best position for hyposesis in completed grid.");
-
-    return bestPosition;
-}
-
-Value SelectHypothesisValue(Grid& grid, Position const& hypothesisCellPosition)
-{
-    auto const& possibilities = grid.GetCell(hypothesisCellPosition).GetPossibilities();
-
-    return possibilities.GetPossibilityLeft();
-}
-
 void SetHypotheticCellValue(Grid& grid, FoundPositions& foundPositions, Position const& hypothesisCellPosition, Value valueToTry)
 {
-    auto& hypothesisCell = grid.GetCell(hypothesisCellPosition);
+    auto hypothesisCell = grid.GetCell(hypothesisCellPosition);
 
     hypothesisCell.SetValue(valueToTry);
-    foundPositions.push(hypothesisCell.GetPosition());
+    foundPositions.push(hypothesisCellPosition);
 }
 
-bool CellHasOnlyOnePossibilityLeft(Grid& grid, Position const& position)
+// The cell tried may be left with a single possibility when branching on the cells of a unit
+void RemoveWrongHypotheticCellValue(Grid& grid, FoundPositions& foundPositions, Branch const& branch, Hypothesis const& hypothesis)
 {
-    return grid.GetCell(position).GetNumberPossibilitiesLeft() == 1;
-}
+    auto hypothesisCell = grid.GetCell(hypothesis.m_Position);
 
-void RemoveWrongHypotheticCellValue(Grid& gridBeforeHypothesis, Position const& hypothesisCellPosition, Value triedValue)
-{
-    gridBeforeHypothesis.GetCell(hypothesisCellPosition).RemovePossibility(triedValue);
-}
-
-} // anonymous namespace
-
-GridSolverWithHypothesisImpl::GridSolverWithHypothesisImpl(
-        std::unique_ptr<GridSolverWithoutHypothesis> gridSolverWithoutHypothesis) :
-    m_GridSolverWithoutHypothesis(std::move(gridSolverWithoutHypothesis))
-{}
-
-bool GridSolverWithHypothesisImpl::Solve(Grid& grid) const
-{
-    FoundPositions foundPositions;
-    GetFoundPositions(grid, foundPositions);
+    hypothesisCell.RemovePossibility(hypothesis.m_Value);
 
-    return SolveWithtHypothesis(grid, foundPositions);
+    if (branch.m_Kind == Branch::Kind::UnitCells && hypothesisCell.IsSet())
+        foundPositions.push(hypothesis.m_Position);
 }
 
-bool GridSolverWithHypothesisImpl::SolveWithtHypothesis(Grid& grid, FoundPositions& foundPositions) const
-{
-    auto status = m_GridSolverWithoutHypothesis->Solve(grid, foundPositions);
-
-    if (status == GridStatus::SolvedCorrectly)
-        return true;
-
-    if (status == GridStatus::Wrong)
-        return false;
-
-    auto gridBeforeHypothesis {grid};
-
-    const auto hypothesisCellPosition = SelectBestPositionForHypothesis(grid);
-
-    while (true)
-    {
-        const auto triedValue = SelectHypothesisValue(grid, hypothesisCellPosition);
-
-        SetHypotheticCellValue(grid, foundPositions, hypothesisCellPosition, triedValue);
-
-        bool solvedCorrectly = SolveWithtHypothesis(grid, foundPositions);
-
-        if (solvedCorrectly)
-            return true;
-
-        if (CellHasOnlyOnePossibilityLeft(gridBeforeHypothesis, hypothesisCellPosition))
-            return false;
-
-        RemoveWrongHypotheticCellValue(gridBeforeHypothesis, hypothesisCellPosition, triedValue);
-        grid = gridBeforeHypothesis;
-    }
-}
+} // namespace detail
+} // namespace sudoku
@@ -1,15 +1,18 @@
 #pragma once
 
+#include <cstdint>
+#include <functional>
 #include <memory>
 
+#include "BranchingStrategy.hpp"
 #include "FoundPositions.hpp"
+#include "GridSolverWithoutHypothesis.hpp"
+#include "GridStatus.hpp"
+#include "Grid.hpp"
 
 namespace sudoku
 {
 
-class GridSolverWithoutHypothesis;
-struct Grid;
-
 class GridSolver
 {
 public:
@@ -18,19 +21,184 @@ public:
     virtual bool Solve(Grid& grid) const = 0;
 };
 
-class GridSolverWithHypothesisImpl : public GridSolver
+// Called with each solution found, the search stops when it returns false
+using SolutionVisitor = std::function<bool(Grid const& solution)>;
+
+// Keeps searching once a solution is found, to tell apart the grids with several solutions
+class SolutionsFinder
+{
+public:
+    virtual ~SolutionsFinder() = default;
+
+    // Number of solutions of the grid, the search stops as soon as limit solutions are found.
+    // A limit of 2 is enough to know if the solution is unique.
+    virtual int CountSolutions(Grid const& grid, int limit) const = 0;
+
+    // Visits the solutions of the grid as they are found, without keeping them.
+    // Returns the number of solutions visited.
+    virtual std::int64_t EnumerateSolutions(Grid const& grid, SolutionVisitor const& visitor) const = 0;
+};
+
+template<typename TGridSolverWithoutHypothesis = GridSolverWithoutHypothesis, typename TBranchingStrategy = BranchingStrategy>
+class GridSolverWithHypothesisImpl final : public GridSolver, public SolutionsFinder
 {
 public:
     GridSolverWithHypothesisImpl(
-            std::unique_ptr<GridSolverWithoutHypothesis> gridSolverWithoutHypothesis);
+            std::unique_ptr<TGridSolverWithoutHypothesis> gridSolverWithoutHypothesis,
+            std::unique_ptr<TBranchingStrategy> branchingStrategy);
 
     bool Solve(Grid& grid) const override;
+    int CountSolutions(Grid const& grid, int limit) const override;
+    std::int64_t EnumerateSolutions(Grid const& grid, SolutionVisitor const& visitor) const override;
 
 private:
-    bool SolveWithtHypothesis(Grid& grid, FoundPositions& foundPositions) const;
+    template<typename TOnSolution>
+    void SearchSolutions(Grid const& grid, TOnSolution const& onSolution) const;
 
-    std::unique_ptr<GridSolverWithoutHypothesis> m_GridSolverWithoutHypothesis;
+    std::unique_ptr<TGridSolverWithoutHypothesis> m_GridSolverWithoutHypothesis;
+    std::unique_ptr<TBranchingStrategy> m_BranchingStrategy;
 };
 
-} /* namespace sudoku */
+namespace detail
+{
+void GetFoundPositions(Grid const& grid, FoundPositions& foundPositions);
+void SetHypotheticCellValue(Grid& grid, FoundPositions& foundPositions, Position const& hypothesisCellPosition, Value valueToTry);
+void RemoveWrongHypotheticCellValue(Grid& grid, FoundPositions& foundPositions, Branch const& branch, Hypothesis const& hypothesis);
+
+// Depth first search of the hypotheses, the grid must have a trail.
+// onSolution(grid) is called on every solution found, the search ends leaving the grid solved when it returns true.
+// Given up, returning false, as soon as stopRequested() returns true.
+template<typename TGridSolverWithoutHypothesis, typename TBranchingStrategy, typename TOnSolution, typename TStopRequested>
+bool SearchWithHypothesis(Grid& grid, FoundPositions& foundPositions,
+                          TGridSolverWithoutHypothesis const& gridSolverWithoutHypothesis,
+                          TBranchingStrategy const& branchingStrategy,
+                          TOnSolution const& onSolution,
+                          TStopRequested const& stopRequested);
+
+// Search ending on the first solution
+template<typename TGridSolverWithoutHypothesis, typename TBranchingStrategy, typename TStopRequested>
+bool SolveWithtHypothesis(Grid& grid, FoundPositions& foundPositions,
+                          TGridSolverWithoutHypothesis const& gridSolverWithoutHypothesis,
+                          TBranchingStrategy const& branchingStrategy,
+                          TStopRequested const& stopRequested);
+} // namespace detail
+
+template<typename TGridSolverWithoutHypothesis, typename TBranchingStrategy>
+GridSolverWithHypothesisImpl<TGridSolverWithoutHypothesis, TBranchingStrategy>::GridSolverWithHypothesisImpl(
+        std::unique_ptr<TGridSolverWithoutHypothesis> gridSolverWithoutHypothesis,
+        std::unique_ptr<TBranchingStrategy> branchingStrategy) :
+    m_GridSolverWithoutHypothesis(std::move(gridSolverWithoutHypothesis)),
+    m_BranchingStrategy(std::move(branchingStrategy))
+{}
+
+template<typename TGridSolverWithoutHypothesis, typename TBranchingStrategy>
+bool GridSolverWithHypothesisImpl<TGridSolverWithoutHypothesis, TBranchingStrategy>::Solve(Grid& grid) const
+{
+    FoundPositions foundPositions;
+    detail::GetFoundPositions(grid, foundPositions);
+
+    Trail trail {grid.GetCellsCount()};
+    ScopedTrail scopedTrail {grid, trail};
+
+    return detail::SolveWithtHypothesis(grid, foundPositions, *m_GridSolverWithoutHypothesis, *m_BranchingStrategy, []{ return false; });
+}
+
+template<typename TGridSolverWithoutHypothesis, typename TBranchingStrategy>
+int GridSolverWithHypothesisImpl<TGridSolverWithoutHypothesis, TBranchingStrategy>::CountSolutions(Grid const& grid, int limit) const
+{
+    if (limit <= 0)
+        return 0;
+
+    int solutionsCount = 0;
+
+    SearchSolutions(grid, [&solutionsCount, limit](Grid const&){ return ++solutionsCount == limit; });
+
+    return solutionsCount;
+}
+
+template<typename TGridSolverWithoutHypothesis, typename TBranchingStrategy>
+std::int64_t GridSolverWithHypothesisImpl<TGridSolverWithoutHypothesis, TBranchingStrategy>::EnumerateSolutions(
+        Grid const& grid, SolutionVisitor const& visitor) const
+{
+    std::int64_t solutionsCount = 0;
 
+    SearchSolutions(grid, [&solutionsCount, &visitor](Grid const& solution)
+        {
+            solutionsCount++;
+            return !visitor(solution);
+        });
+
+    return solutionsCount;
+}
+
+// The grid searched is a copy, the solutions found are rolled back to go on searching
+template<typename TGridSolverWithoutHypothesis, typename TBranchingStrategy>
+template<typename TOnSolution>
+void GridSolverWithHypothesisImpl<TGridSolverWithoutHypothesis, TBranchingStrategy>::SearchSolutions(
+        Grid const& grid, TOnSolution const& onSolution) const
+{
+    Grid searchedGrid {grid};
+
+    FoundPositions foundPositions;
+    detail::GetFoundPositions(searchedGrid, foundPositions);
+
+    Trail trail {searchedGrid.GetCellsCount()};
+    ScopedTrail scopedTrail {searchedGrid, trail};
+
+    detail::SearchWithHypothesis(searchedGrid, foundPositions, *m_GridSolverWithoutHypothesis, *m_BranchingStrategy,
+                                 onSolution, []{ return false; });
+}
+
+template<typename TGridSolverWithoutHypothesis, typename TBranchingStrategy, typename TOnSolution, typename TStopRequested>
+bool detail::SearchWithHypothesis(Grid& grid, FoundPositions& foundPositions,
+                                  TGridSolverWithoutHypothesis const& gridSolverWithoutHypothesis,
+                                  TBranchingStrategy const& branchingStrategy,
+                                  TOnSolution const& onSolution,
+                                  TStopRequested const& stopRequested)
+{
+    if (stopRequested())
+        return false;
+
+    auto status = gridSolverWithoutHypothesis.Solve(grid, foundPositions);
+
+    if (status == GridStatus::SolvedCorrectly)
+        return onSolution(static_cast<Grid const&>(grid));
+
+    if (status == GridStatus::Wrong)
+        return false;
+
+    const auto branch = branchingStrategy.SelectBranch(grid);
+    auto gridBeforeHypothesis = grid.GetTrailCheckpoint();
+
+    while (true)
+    {
+        const auto hypothesis = branchingStrategy.SelectHypothesis(grid, branch);
+
+        SetHypotheticCellValue(grid, foundPositions, hypothesis.m_Position, hypothesis.m_Value);
+
+        bool searchEnded = SearchWithHypothesis(grid, foundPositions, gridSolverWithoutHypothesis, branchingStrategy, onSolution, stopRequested);
+
+        if (searchEnded)
+            return true;
+
+        grid.RollBack(gridBeforeHypothesis);
+
+        if (CountHypothesesLeft(grid, branch) == 1)
+            return false;
+
+        RemoveWrongHypotheticCellValue(grid, foundPositions, branch, hypothesis);
+        gridBeforeHypothesis = grid.GetTrailCheckpoint();
+    }
+}
+
+template<typename TGridSolverWithoutHypothesis, typename TBranchingStrategy, typename TStopRequested>
+bool detail::SolveWithtHypothesis(Grid& grid, FoundPositions& foundPositions,
+                                  TGridSolverWithoutHypothesis const& gridSolverWithoutHypothesis,
+                                  TBranchingStrategy const& branchingStrategy,
+                                  TStopRequested const& stopRequested)
+{
+    return SearchWithHypothesis(grid, foundPositions, gridSolverWithoutHypothesis, branchingStrategy,
+                                [](Grid const&){ return true; }, stopRequested);
+}
+
+} /* namespace sudoku */
@@ -3,14 +3,15 @@
 #include <memory>
 
 #include "FoundPositions.hpp"
+#include "GridPossibilitiesUpdater.hpp"
+#include "UniquePossibilitySetter.hpp"
+#include "PatternPossibilitiesRemover.hpp"
+#include "GridStatus.hpp"
 
 namespace sudoku
 {
 
-class GridPossibilitiesUpdater;
-class UniquePossibilitySetter;
-struct Grid;
-enum class GridStatus;
+class Grid;
 
 class GridSolverWithoutHypothesis
 {
@@ -20,19 +21,78 @@ public:
     virtual GridStatus Solve(Grid& grid, FoundPositions& foundPositions) const = 0;
 };
 
-class GridSolverWithoutHypothesisImpl : public GridSolverWithoutHypothesis
+template<typename TGridPossibilitiesUpdater = GridPossibilitiesUpdater, typename TUniquePossibilitySetter = UniquePossibilitySetter,
+         typename TPatternPossibilitiesRemover = PatternPossibilitiesRemover>
+class GridSolverWithoutHypothesisImpl final : public GridSolverWithoutHypothesis
 {
 public:
     GridSolverWithoutHypothesisImpl(
-            std::unique_ptr<GridPossibilitiesUpdater> gridPossibilitiesUpdater,
-            std::unique_ptr<UniquePossibilitySetter> uniquePossibilitySetter);
+            std::unique_ptr<TGridPossibilitiesUpdater> gridPossibilitiesUpdater,
+            std::unique_ptr<TUniquePossibilitySetter> uniquePossibilitySetter,
+            std::unique_ptr<TPatternPossibilitiesRemover> patternPossibilitiesRemover);
 
     GridStatus Solve(Grid& grid, FoundPositions& foundPositions) const override;
 
 private:
-    std::unique_ptr<GridPossibilitiesUpdater> m_GridPossibilitiesUpdater;
-    std::unique_ptr<UniquePossibilitySetter> m_UniquePossibilitySetter;
+    std::unique_ptr<TGridPossibilitiesUpdater> m_GridPossibilitiesUpdater;
+    std::unique_ptr<TUniquePossibilitySetter> m_UniquePossibilitySetter;
+    std::unique_ptr<TPatternPossibilitiesRemover> m_PatternPossibilitiesRemover;
 };
 
+namespace detail
+{
+bool AreAllCellsSet(Grid const& grid);
+void ClearFoundPositions(FoundPositions& foundPositions);
+} // namespace detail
+
+template<typename TGridPossibilitiesUpdater, typename TUniquePossibilitySetter, typename TPatternPossibilitiesRemover>
+GridSolverWithoutHypothesisImpl<TGridPossibilitiesUpdater, TUniquePossibilitySetter, TPatternPossibilitiesRemover>::GridSolverWithoutHypothesisImpl(
+        std::unique_ptr<TGridPossibilitiesUpdater> gridPossibilitiesUpdater,
+        std::unique_ptr<TUniquePossibilitySetter> uniquePossibilitySetter,
+        std::unique_ptr<TPatternPossibilitiesRemover> patternPossibilitiesRemover) :
+    m_GridPossibilitiesUpdater(std::move(gridPossibilitiesUpdater)),
+    m_UniquePossibilitySetter(std::move(uniquePossibilitySetter)),
+    m_PatternPossibilitiesRemover(std::move(patternPossibilitiesRemover))
+{}
+
+template<typename TGridPossibilitiesUpdater, typename TUniquePossibilitySetter, typename TPatternPossibilitiesRemover>
+GridStatus GridSolverWithoutHypothesisImpl<TGridPossibilitiesUpdater, TUniquePossibilitySetter, TPatternPossibilitiesRemover>::Solve(Grid& grid, FoundPositions& foundPositions) const
+{
+    // Without found cells, as for a grid without givens, only the pattern deductions can make progress
+    while (true)
+    {
+        while(!foundPositions.empty())
+        {
+            if (!m_GridPossibilitiesUpdater->UpdateGrid(foundPositions, grid)
+                    || !m_UniquePossibilitySetter->SetCellsWithUniquePossibility(grid, foundPositions))
+            {
+                detail::ClearFoundPositions(foundPositions);
+                return GridStatus::Wrong;
+            }
+        }
+
+        if (detail::AreAllCellsSet(grid))
+            return GridStatus::SolvedCorrectly;
+
+        bool possibilitiesRemoved {false};
+
+        if (!m_PatternPossibilitiesRemover->RemovePossibilities(grid, foundPositions, possibilitiesRemoved))
+        {
+            detail::ClearFoundPositions(foundPositions);
+            return GridStatus::Wrong;
+        }
+
+        if (!possibilitiesRemoved)
+            return GridStatus::Incomplete;
+
+        // The units the deduction removed possibilities from may now hold a value left in a single cell
+        if (!m_UniquePossibilitySetter->SetCellsWithUniquePossibility(grid, foundPositions))
+        {
+            detail::ClearFoundPositions(foundPositions);
+            return GridStatus::Wrong;
+        }
+    }
+}
+
 } /* namespace sudoku */
 
@@ -2,80 +2,29 @@
 
 #include <algorithm>
 
-#include <boost/range/adaptors.hpp>
-#include <boost/algorithm/algorithm.hpp>
-#include <boost/algorithm/cxx11/all_of.hpp>
-#include <boost/algorithm/cxx11/none_of.hpp>
+#include <boost/range/iterator_range.hpp>
 
 #include "Grid.hpp"
 #include "GridStatus.hpp"
+#include "UnitsFold.hpp"
 
 using namespace sudoku;
 
-namespace
-{
-std::vector<std::reference_wrapper<Cell>> GetCellsSet(Grid& grid)
-{
-    std::vector<std::reference_wrapper<Cell>> cellsSet;
-
-    std::copy_if(grid.begin(), grid.end(), std::back_inserter(cellsSet), [](auto const& cell){ return cell.IsSet(); });
-
-    return cellsSet;
-}
-
-std::vector<Value> GetSetCellValues(Range<Position> const& relatedPositions, Grid const& grid)
-{
-    std::vector<Value> setCells;
-
-    for (auto const& position : relatedPositions)
-    {
-        auto val = grid.GetCell(position).GetValue();
-
-        if (val)
-            setCells.push_back(*val);
-    }
-
-    return setCells;
-}
-
-bool AreAllCellsSet(Grid& grid)
-{
-    return std::all_of(grid.begin(), grid.end(), [](auto const& cell){ return cell.IsSet(); });
-}
-} // anonymous namespace
-
 GridStatus GridStatusGetterImpl::GetStatus(Grid& grid) const
 {
-    if (!AreSetCellsValid(grid))
-        return GridStatus::Wrong;
-
-    return AreAllCellsSet(grid) ? GridStatus::SolvedCorrectly : GridStatus::Incomplete;
-}
-
-bool GridStatusGetterImpl::AreSetCellsValid(Grid& grid) const
-{
-    auto cellsSet = GetCellsSet(grid);
-
-    return AreCellsValid(cellsSet, grid);
-}
+    const auto fold = FoldSetValues(grid);
+    const auto gridSize = grid.GetGridSize();
 
-std::vector<Value> GridStatusGetterImpl::GetRelatedCellsSetValue(Position const& selectedPosition, Grid& grid) const
-{
-    auto relatedPositions = m_RelatedPositionsGetter.GetAllRelatedPositions(selectedPosition, grid.GetGridSize());
+    const auto duplicatedValues = boost::make_iterator_range_n(fold.m_DuplicatedValues.begin(), grid.GetUnits().GetUnitsCount());
 
-    return GetSetCellValues(relatedPositions, grid);
-}
-
-bool GridStatusGetterImpl::IsCellValueValid(Cell const& cell, Grid& grid) const
-{
-    auto relatedCellSetValues = GetRelatedCellsSetValue(cell.GetPosition(), grid);
-
-    return boost::algorithm::none_of_equal(relatedCellSetValues, *cell.GetValue());
-}
+    if (std::any_of(duplicatedValues.begin(), duplicatedValues.end(), [](auto values){ return values != 0; }))
+        return GridStatus::Wrong;
 
-bool GridStatusGetterImpl::AreCellsValid(std::vector<std::reference_wrapper<Cell>> const& cellsSet, Grid& grid) const
-{
-    auto isCellValueValid = [&](Cell const& cell){ return IsCellValueValid(cell, grid); };
+    // Without duplicates, a row is complete when all the values are set in it
+    const auto allValues = Possibilities {gridSize}.GetBitSet();
+    const auto rowsSetValues = boost::make_iterator_range_n(fold.m_SetValues.begin() + gridSize, gridSize);
 
-    return boost::algorithm::all_of(cellsSet, isCellValueValid);
+    return std::all_of(rowsSetValues.begin(), rowsSetValues.end(), [allValues](auto values){ return values == allValues; })
+            ? GridStatus::SolvedCorrectly
+            : GridStatus::Incomplete;
 }
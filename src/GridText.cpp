@@ -0,0 +1,90 @@
+#include "GridText.hpp"
+
+#include <array>
+#include <stdexcept>
+
+#include "GridSize.hpp"
+
+namespace sudoku
+{
+
+namespace
+{
+
+constexpr Value EmptyCell {0};
+constexpr Value NotAValue {-1};
+
+// Indexed by character
+constexpr std::array<Value, 256> CreateCharValues()
+{
+    std::array<Value, 256> charValues {};
+
+    for (auto& value : charValues)
+        value = NotAValue;
+
+    charValues['.'] = EmptyCell;
+    charValues['0'] = EmptyCell;
+
+    for (Value value = 1; value <= 9; value++)
+        charValues['0' + value] = value;
+
+    for (Value value = 10; value <= MaxGridSize; value++)
+        charValues['A' + value - 10] = value;
+
+    return charValues;
+}
+
+constexpr auto CharValues = CreateCharValues();
+
+// Indexed by value, 0 for the empty cells
+constexpr char ValueChars[] {".123456789ABCDEFGHIJKLMNOP"};
+
+static_assert(sizeof(ValueChars) == MaxGridSize + 2, "A character is needed for each value");
+
+} // anonymous namespace
+
+Grid ParseGrid(std::string_view line)
+{
+    const int gridSize = line.size() <= MaxGridSize * MaxGridSize ? isqrt(line.size()) : 0;
+
+    if (gridSize * gridSize != static_cast<int>(line.size()))
+        throw std::runtime_error("A grid line can't be " + std::to_string(line.size()) + " characters long");
+
+    // Throws if the size isn't supported
+    Grid grid {VisitGridSize(gridSize, [](auto size){ return decltype(size)::value; })};
+
+    // Only the given cells are updated in the empty grid, rebuilding all its units would take longer
+    for (int index = 0; index < grid.GetCellsCount(); index++)
+    {
+        const auto value = CharValues[static_cast<unsigned char>(line[index])];
+
+        if (value == EmptyCell)
+            continue;
+
+        if (value == NotAValue || value > gridSize)
+            throw std::runtime_error(std::string("Unexpected character '") + line[index] + "' in a grid line");
+
+        grid.SetValue(index, value);
+    }
+
+    return grid;
+}
+
+void FormatGrid(Grid const& grid, char* buffer)
+{
+    for (int index = 0; index < grid.GetCellsCount(); index++)
+    {
+        auto const& possibilities = grid.GetPossibilities(index);
+        buffer[index] = ValueChars[possibilities.OnlyOnePossibilityLeft() ? possibilities.GetPossibilityLeft() : EmptyCell];
+    }
+}
+
+std::string FormatGrid(Grid const& grid)
+{
+    std::string line(grid.GetCellsCount(), '.');
+    FormatGrid(grid, line.data());
+
+    return line;
+}
+
+} // namespace sudoku
@@ -0,0 +1,25 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+
+#include "Constants.hpp"
+#include "Grid.hpp"
+
+namespace sudoku
+{
+
+// Grids written on one line, row after row: '.' or '0' for the empty cells, '1' to '9' for the values up to 9
+// and 'A', 'B', ... for the values from 10.
+// The grid size is deduced from the length of the line. Throws if the line isn't a grid of a supported size.
+Grid ParseGrid(std::string_view line);
+
+// Longest line written by FormatGrid
+inline constexpr int MaxGridLineLength {MaxGridSize * MaxGridSize};
+
+// Same format, '.' for the cells not set. Writes the grid's cells count characters to buffer, without line end.
+void FormatGrid(Grid const& grid, char* buffer);
+
+std::string FormatGrid(Grid const& grid);
+
+} // namespace sudoku
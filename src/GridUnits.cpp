@@ -0,0 +1,61 @@
+#include "GridUnits.hpp"
+
+#include <memory>
+#include <stdexcept>
+#include <string>
+
+#include "Constants.hpp"
+#include "GridSize.hpp"
+
+namespace sudoku
+{
+
+GridUnits::GridUnits(int gridSize) :
+    m_GridSize(gridSize),
+    m_CellSlots(gridSize * gridSize),
+    m_UnitCells(UnitsPerCell * gridSize * gridSize)
+{
+    const auto blockRows = GetBlockRows(gridSize);
+    const auto blockCols = GetBlockCols(gridSize);
+
+    for (int row = 0; row < gridSize; row++)
+    {
+        for (int col = 0; col < gridSize; col++)
+        {
+            const auto index = row * gridSize + col;
+            const auto block = (row / blockRows) * (gridSize / blockCols) + col / blockCols;
+
+            m_CellSlots[index] = {{
+                {col, row},
+                {gridSize + row, col},
+                {2 * gridSize + block, (row % blockRows) * blockCols + col % blockCols}
+            }};
+
+            for (auto const& [unit, slot] : m_CellSlots[index])
+                m_UnitCells[unit * gridSize + slot] = index;
+        }
+    }
+}
+
+GridUnits const& GridUnits::Get(int gridSize)
+{
+    static const auto allGridUnits = []
+    {
+        std::array<std::unique_ptr<GridUnits const>, MaxGridSize + 1> allGridUnits;
+
+        for (int size = 0; size <= MaxGridSize; size++)
+        {
+            if (HasValidBlocks(size))
+                allGridUnits[size].reset(new GridUnits(size));
+        }
+
+        return allGridUnits;
+    }();
+
+    if (gridSize < 0 || gridSize > MaxGridSize || !allGridUnits[gridSize])
+        throw std::runtime_error("Grid size '" + std::to_string(gridSize) + "' can't be split in units");
+
+    return *allGridUnits[gridSize];
+}
+
+} // namespace sudoku
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+namespace sudoku
+{
+
+// Bit i set means the i-th cell of a unit
+using UnitSlotsBitSet = std::uint32_t;
+
+// Columns, rows and blocks of a grid, numbered in that order:
+// column c is unit c, row r is unit gridSize + r and block b is unit 2 * gridSize + b.
+class GridUnits
+{
+public:
+    struct CellSlot
+    {
+        int m_Unit;
+        int m_Slot;
+    };
+
+    static constexpr int UnitsPerCell {3};
+
+    using CellSlots = std::array<CellSlot, UnitsPerCell>;
+
+    // One bit set per unit: bit i of word k is unit k * gridSize + i
+    using UnitsBitSet = std::array<std::uint32_t, UnitsPerCell>;
+
+    // The units of every valid grid size are generated on first use and shared
+    static GridUnits const& Get(int gridSize);
+
+    int GetUnitsCount() const { return UnitsPerCell * m_GridSize; }
+
+    CellSlots const& GetCellSlots(int index) const { return m_CellSlots[index]; }
+
+    int GetCellIndex(int unit, int slot) const { return m_UnitCells[unit * m_GridSize + slot]; }
+
+private:
+    GridUnits(int gridSize);
+
+    int m_GridSize;
+
+    std::vector<CellSlots> m_CellSlots;
+    std::vector<int> m_UnitCells;
+};
+
+} // namespace sudoku
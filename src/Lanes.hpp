@@ -0,0 +1,98 @@
+#pragma once
+
+#if defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+#include "Possibilities.hpp"
+
+namespace sudoku
+{
+namespace detail
+{
+
+static_assert(sizeof(Possibilities) == sizeof(PossibilitiesBitSet), "Possibilities are loaded as packed bit sets");
+
+// Vectors of bit sets, operated on lane by lane.
+// Masks returned by IsZero have all their bits set in the matching lanes.
+struct ScalarLanes
+{
+    using Type = PossibilitiesBitSet;
+    static constexpr int Width {1};
+
+    static Type Zero() { return 0; }
+    static Type Load(Possibilities const* cells) { return cells->GetBitSet(); }
+    static Type Load(PossibilitiesBitSet const* bitSets) { return *bitSets; }
+    static void Store(PossibilitiesBitSet* bitSets, Type lanes) { *bitSets = lanes; }
+    static Type And(Type lhs, Type rhs) { return lhs & rhs; }
+    static Type Or(Type lhs, Type rhs) { return lhs | rhs; }
+    static Type AndNot(Type lhs, Type rhs) { return lhs & ~rhs; }
+    static Type IsZero(Type lanes) { return lanes == 0 ? ~Type{} : 0; }
+    static Type Select(Type mask, Type lhs, Type rhs) { return (mask & lhs) | (~mask & rhs); }
+    static bool AnyNonZero(Type lanes) { return lanes != 0; }
+
+    // Cells with more than one possibility left are cleared
+    static Type SetValues(Type lanes) { return (lanes & (lanes - 1)) == 0 ? lanes : 0; }
+};
+
+#if defined(__SSE2__)
+struct Sse2Lanes
+{
+    using Type = __m128i;
+    static constexpr int Width {4};
+
+    static Type Zero() { return _mm_setzero_si128(); }
+    static Type Load(Possibilities const* cells) { return _mm_loadu_si128(reinterpret_cast<__m128i const*>(cells)); }
+    static Type Load(PossibilitiesBitSet const* bitSets) { return _mm_loadu_si128(reinterpret_cast<__m128i const*>(bitSets)); }
+    static void Store(PossibilitiesBitSet* bitSets, Type lanes) { _mm_storeu_si128(reinterpret_cast<__m128i*>(bitSets), lanes); }
+    static Type And(Type lhs, Type rhs) { return _mm_and_si128(lhs, rhs); }
+    static Type Or(Type lhs, Type rhs) { return _mm_or_si128(lhs, rhs); }
+    static Type AndNot(Type lhs, Type rhs) { return _mm_andnot_si128(rhs, lhs); }
+    static Type IsZero(Type lanes) { return _mm_cmpeq_epi32(lanes, _mm_setzero_si128()); }
+    static Type Select(Type mask, Type lhs, Type rhs) { return _mm_or_si128(_mm_and_si128(mask, lhs), _mm_andnot_si128(mask, rhs)); }
+    static bool AnyNonZero(Type lanes) { return _mm_movemask_epi8(IsZero(lanes)) != 0xFFFF; }
+
+    static Type SetValues(Type lanes)
+    {
+        const auto withoutLowestBit = _mm_and_si128(lanes, _mm_sub_epi32(lanes, _mm_set1_epi32(1)));
+        return _mm_and_si128(lanes, IsZero(withoutLowestBit));
+    }
+};
+#endif
+
+#if defined(__AVX2__)
+struct Avx2Lanes
+{
+    using Type = __m256i;
+    static constexpr int Width {8};
+
+    static Type Zero() { return _mm256_setzero_si256(); }
+    static Type Load(Possibilities const* cells) { return _mm256_loadu_si256(reinterpret_cast<__m256i const*>(cells)); }
+    static Type Load(PossibilitiesBitSet const* bitSets) { return _mm256_loadu_si256(reinterpret_cast<__m256i const*>(bitSets)); }
+    static void Store(PossibilitiesBitSet* bitSets, Type lanes) { _mm256_storeu_si256(reinterpret_cast<__m256i*>(bitSets), lanes); }
+    static Type And(Type lhs, Type rhs) { return _mm256_and_si256(lhs, rhs); }
+    static Type Or(Type lhs, Type rhs) { return _mm256_or_si256(lhs, rhs); }
+    static Type AndNot(Type lhs, Type rhs) { return _mm256_andnot_si256(rhs, lhs); }
+    static Type IsZero(Type lanes) { return _mm256_cmpeq_epi32(lanes, _mm256_setzero_si256()); }
+    static Type Select(Type mask, Type lhs, Type rhs) { return _mm256_blendv_epi8(rhs, lhs, mask); }
+    static bool AnyNonZero(Type lanes) { return !_mm256_testz_si256(lanes, lanes); }
+
+    static Type SetValues(Type lanes)
+    {
+        const auto withoutLowestBit = _mm256_and_si256(lanes, _mm256_sub_epi32(lanes, _mm256_set1_epi32(1)));
+        return _mm256_and_si256(lanes, IsZero(withoutLowestBit));
+    }
+};
+#endif
+
+// Widest lanes the build allows
+#if defined(__AVX2__)
+using VectorLanes = Avx2Lanes;
+#elif defined(__SSE2__)
+using VectorLanes = Sse2Lanes;
+#else
+using VectorLanes = ScalarLanes;
+#endif
+
+} // namespace detail
+} // namespace sudoku
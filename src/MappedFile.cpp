@@ -0,0 +1,56 @@
+#include "MappedFile.hpp"
+
+#include <stdexcept>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace sudoku
+{
+
+MappedFile::MappedFile(std::string const& fileName)
+{
+    const int fd = open(fileName.c_str(), O_RDONLY);
+
+    if (fd < 0)
+        throw std::runtime_error("Can't open '" + fileName + "'");
+
+    struct stat fileStat;
+
+    if (fstat(fd, &fileStat) != 0)
+    {
+        close(fd);
+        throw std::runtime_error("Can't get the size of '" + fileName + "'");
+    }
+
+    m_Size = fileStat.st_size;
+
+    // An empty file can't be mapped, and has nothing to read anyway
+    if (m_Size > 0)
+    {
+        void* data = mmap(nullptr, m_Size, PROT_READ, MAP_PRIVATE, fd, 0);
+
+        if (data == MAP_FAILED)
+        {
+            close(fd);
+            throw std::runtime_error("Can't map '" + fileName + "'");
+        }
+
+        // Read from start to end, the pages can be read ahead and dropped once read
+        madvise(data, m_Size, MADV_SEQUENTIAL);
+
+        m_Data = static_cast<char const*>(data);
+    }
+
+    close(fd);
+}
+
+MappedFile::~MappedFile()
+{
+    if (m_Data)
+        munmap(const_cast<char*>(m_Data), m_Size);
+}
+
+} // namespace sudoku
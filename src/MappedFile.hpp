@@ -0,0 +1,28 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+namespace sudoku
+{
+
+// File mapped read only in memory for the lifetime of the object, so that its content is read without being copied.
+// Throws if the file can't be opened or mapped.
+class MappedFile
+{
+public:
+    MappedFile(std::string const& fileName);
+    ~MappedFile();
+
+    MappedFile(MappedFile const&) = delete;
+    MappedFile& operator=(MappedFile const&) = delete;
+
+    std::string_view GetContent() const { return {m_Data, m_Size}; }
+
+private:
+    char const* m_Data {nullptr};
+    std::size_t m_Size {0};
+};
+
+} // namespace sudoku
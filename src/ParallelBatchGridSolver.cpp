@@ -0,0 +1,111 @@
+#include "ParallelBatchGridSolver.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <exception>
+#include <stdexcept>
+
+#include "Constants.hpp"
+#include "GridSize.hpp"
+
+using namespace sudoku;
+
+namespace
+{
+
+// Enough grids per task to fill the vector lanes of the batch grid solvers
+constexpr std::size_t GridsPerTask {detail::BatchWidth};
+
+// The results of each task have their own cache line, so that the workers don't write to the same lines
+struct alignas(CacheLineSize) TaskResults
+{
+    std::array<bool, GridsPerTask> m_Solved {};
+};
+
+} // anonymous namespace
+
+ParallelBatchGridSolverImpl::ParallelBatchGridSolverImpl(
+        std::vector<std::unique_ptr<BatchGridSolver>> batchGridSolvers,
+        std::shared_ptr<ThreadPool> threadPool) :
+    m_BatchGridSolvers(std::move(batchGridSolvers)),
+    m_ThreadPool(std::move(threadPool))
+{
+    if (static_cast<int>(m_BatchGridSolvers.size()) != m_ThreadPool->GetThreadsCount() + 1)
+        throw std::runtime_error("A batch grid solver is needed for each thread of the pool and for the calling thread");
+}
+
+std::vector<bool> ParallelBatchGridSolverImpl::Solve(int gridSize, std::uint8_t* values, std::size_t count) const
+{
+    // Throws here rather than in the tasks
+    VisitGridSize(gridSize, [](auto){});
+
+    const std::size_t cellsCount = gridSize * gridSize;
+
+    std::vector<TaskResults> tasksResults((count + GridsPerTask - 1) / GridsPerTask);
+    std::atomic<std::size_t> tasksLeft {0};
+
+    // First error of a task, the tasks left then skip their grids
+    std::exception_ptr error;
+    std::atomic<bool> failed {false};
+
+    auto keepFirstError = [&error, &failed]
+        {
+            if (!failed.exchange(true))
+                error = std::current_exception();
+        };
+
+    // Every task queued is counted as done, even if it throws, before its results go out of scope
+    for (std::size_t first = 0; first < count && !failed; first += GridsPerTask)
+    {
+        tasksLeft++;
+
+        try
+        {
+            m_ThreadPool->Submit([this, gridSize, values, cellsCount, count, first, &tasksResults, &tasksLeft, &failed, &keepFirstError]
+                {
+                    try
+                    {
+                        if (!failed)
+                        {
+                            const auto last = std::min(first + GridsPerTask, count);
+                            const auto solved = GetCurrentThreadBatchGridSolver().Solve(gridSize, values + first * cellsCount, last - first);
+
+                            std::copy(solved.begin(), solved.end(), tasksResults[first / GridsPerTask].m_Solved.begin());
+                        }
+                    }
+                    catch (...)
+                    {
+                        keepFirstError();
+                    }
+
+                    if (--tasksLeft == 0)
+                        m_ThreadPool->WakeUp();
+                });
+        }
+        catch (...)
+        {
+            tasksLeft--;
+            keepFirstError();
+        }
+    }
+
+    m_ThreadPool->RunTasksUntil([&tasksLeft]{ return tasksLeft == 0; });
+
+    if (error)
+        std::rethrow_exception(error);
+
+    std::vector<bool> solved(count);
+
+    for (std::size_t i = 0; i < count; i++)
+        solved[i] = tasksResults[i / GridsPerTask].m_Solved[i % GridsPerTask];
+
+    return solved;
+}
+
+BatchGridSolver const& ParallelBatchGridSolverImpl::GetCurrentThreadBatchGridSolver() const
+{
+    const auto workerIndex = m_ThreadPool->GetCurrentWorkerIndex();
+
+    return *m_BatchGridSolvers[workerIndex >= 0 ? workerIndex : m_BatchGridSolvers.size() - 1];
+}
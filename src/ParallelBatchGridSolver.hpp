@@ -0,0 +1,32 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "BatchGridSolver.hpp"
+#include "ThreadPool.hpp"
+
+namespace sudoku
+{
+
+// Splits the grids into tasks of a few grids run on a thread pool, idle workers stealing the tasks left to the busy ones.
+// Each thread solves its tasks with its own batch grid solver: one per worker of the pool, then one for the calling thread,
+// which runs tasks too while waiting for the grids to be solved.
+// Solve must not be called from several threads at once.
+class ParallelBatchGridSolverImpl final : public BatchGridSolver
+{
+public:
+    ParallelBatchGridSolverImpl(
+            std::vector<std::unique_ptr<BatchGridSolver>> batchGridSolvers,
+            std::shared_ptr<ThreadPool> threadPool);
+
+    std::vector<bool> Solve(int gridSize, std::uint8_t* values, std::size_t count) const override;
+
+private:
+    BatchGridSolver const& GetCurrentThreadBatchGridSolver() const;
+
+    std::vector<std::unique_ptr<BatchGridSolver>> m_BatchGridSolvers;
+    std::shared_ptr<ThreadPool> m_ThreadPool;
+};
+
+} /* namespace sudoku */
@@ -0,0 +1,98 @@
+#include "ParallelGridGenerator.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <stdexcept>
+
+using namespace sudoku;
+
+namespace
+{
+
+// A grid takes hundreds of microseconds, a few per task are enough to pay for it
+constexpr int GridsPerTask {4};
+
+} // anonymous namespace
+
+ParallelGridGeneratorImpl::ParallelGridGeneratorImpl(
+        std::vector<std::unique_ptr<GridGenerator>> gridGenerators,
+        std::shared_ptr<ThreadPool> threadPool) :
+    m_GridGenerators(std::move(gridGenerators)),
+    m_ThreadPool(std::move(threadPool))
+{
+    if (static_cast<int>(m_GridGenerators.size()) != m_ThreadPool->GetThreadsCount() + 1)
+        throw std::runtime_error("A grid generator is needed for each thread of the pool and for the calling thread");
+}
+
+std::vector<Grid> ParallelGridGeneratorImpl::Generate(int gridsCount, std::uint64_t seed) const
+{
+    const int tasksCount = (std::max(0, gridsCount) + GridsPerTask - 1) / GridsPerTask;
+
+    std::vector<std::vector<Grid>> tasksGrids(tasksCount);
+    std::atomic<int> tasksLeft {0};
+
+    // First error of a task, the tasks left then skip their grids
+    std::exception_ptr error;
+    std::atomic<bool> failed {false};
+
+    auto keepFirstError = [&error, &failed]
+        {
+            if (!failed.exchange(true))
+                error = std::current_exception();
+        };
+
+    // Every task queued is counted as done, even if it throws, before its grids go out of scope
+    for (int task = 0; task < tasksCount && !failed; task++)
+    {
+        tasksLeft++;
+
+        try
+        {
+            m_ThreadPool->Submit([this, gridsCount, seed, task, &tasksGrids, &tasksLeft, &failed, &keepFirstError]
+                {
+                    try
+                    {
+                        if (!failed)
+                        {
+                            const int first = task * GridsPerTask;
+                            const int last = std::min(first + GridsPerTask, gridsCount);
+
+                            tasksGrids[task] = GetCurrentThreadGridGenerator().Generate(last - first, seed + first);
+                        }
+                    }
+                    catch (...)
+                    {
+                        keepFirstError();
+                    }
+
+                    if (--tasksLeft == 0)
+                        m_ThreadPool->WakeUp();
+                });
+        }
+        catch (...)
+        {
+            tasksLeft--;
+            keepFirstError();
+        }
+    }
+
+    m_ThreadPool->RunTasksUntil([&tasksLeft]{ return tasksLeft == 0; });
+
+    if (error)
+        std::rethrow_exception(error);
+
+    std::vector<Grid> grids;
+
+    for (auto const& taskGrids : tasksGrids)
+        grids.insert(grids.end(), taskGrids.begin(), taskGrids.end());
+
+    return grids;
+}
+
+GridGenerator const& ParallelGridGeneratorImpl::GetCurrentThreadGridGenerator() const
+{
+    const auto workerIndex = m_ThreadPool->GetCurrentWorkerIndex();
+
+    return *m_GridGenerators[workerIndex >= 0 ? workerIndex : m_GridGenerators.size() - 1];
+}
@@ -0,0 +1,32 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "GridGenerator.hpp"
+#include "ThreadPool.hpp"
+
+namespace sudoku
+{
+
+// Splits the grids to generate into tasks of a few grids run on a thread pool, idle workers stealing the tasks left to the busy ones.
+// Each thread generates with its own grid generator: one per worker of the pool, then one for the calling thread.
+// The grids are the same, in the same order, as those of a single generator given the same seed.
+// Generate must not be called from several threads at once.
+class ParallelGridGeneratorImpl final : public GridGenerator
+{
+public:
+    ParallelGridGeneratorImpl(
+            std::vector<std::unique_ptr<GridGenerator>> gridGenerators,
+            std::shared_ptr<ThreadPool> threadPool);
+
+    std::vector<Grid> Generate(int gridsCount, std::uint64_t seed) const override;
+
+private:
+    GridGenerator const& GetCurrentThreadGridGenerator() const;
+
+    std::vector<std::unique_ptr<GridGenerator>> m_GridGenerators;
+    std::shared_ptr<ThreadPool> m_ThreadPool;
+};
+
+} /* namespace sudoku */
@@ -0,0 +1,241 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <exception>
+#include <memory>
+#include <mutex>
+
+#include "BranchingStrategy.hpp"
+#include "FoundPositions.hpp"
+#include "GridSolverWithHypothesis.hpp"
+#include "GridSolverWithoutHypothesis.hpp"
+#include "GridStatus.hpp"
+#include "Grid.hpp"
+#include "ThreadPool.hpp"
+
+namespace sudoku
+{
+
+// Splits the top of the hypotheses tree of a grid into tasks run on a thread pool.
+// Only worth it for grids needing many hypotheses, the others are solved sequentially anyway.
+struct ParallelSearch
+{
+    // Threads of the pool, the number of hardware threads when 0
+    int m_ThreadsCount {0};
+
+    // Hypotheses made deeper are explored sequentially by the task which reached them
+    int m_SplitDepth {4};
+
+    // Grids with fewer cells left to set are explored sequentially
+    int m_SplitMinUnsetCells {30};
+};
+
+// The first task to find a solution copies it to the grid solved, and the other tasks then give up.
+// When enumerating, the tasks explore distinct subtrees and the visitor is called by one of them at a time,
+// in no particular order. The calling thread runs tasks of the pool while waiting for the search to end.
+// The first exception thrown by a task, by the visitor for instance, stops the search and is rethrown once all the tasks are done.
+template<typename TGridSolverWithoutHypothesis = GridSolverWithoutHypothesis, typename TBranchingStrategy = BranchingStrategy>
+class ParallelGridSolverWithHypothesisImpl final : public GridSolver, public SolutionsFinder
+{
+public:
+    ParallelGridSolverWithHypothesisImpl(
+            std::unique_ptr<TGridSolverWithoutHypothesis> gridSolverWithoutHypothesis,
+            std::unique_ptr<TBranchingStrategy> branchingStrategy,
+            std::shared_ptr<ThreadPool> threadPool,
+            ParallelSearch const& parallelSearch);
+
+    bool Solve(Grid& grid) const override;
+    int CountSolutions(Grid const& grid, int limit) const override;
+    std::int64_t EnumerateSolutions(Grid const& grid, SolutionVisitor const& visitor) const override;
+
+private:
+    struct Search
+    {
+        SolutionVisitor const& m_Visitor;
+        std::mutex m_VisitorMutex;
+        std::int64_t m_SolutionsCount {0};
+        std::atomic<bool> m_Stopped {false};
+        std::atomic<int> m_TasksCount {0};
+        std::mutex m_ErrorMutex;
+        std::exception_ptr m_Error;
+    };
+
+    void Explore(Search& search, Grid& grid, FoundPositions& foundPositions, int depth) const;
+    // Keeps the first exception of the search and stops it, the tasks left still have to end before the search goes out of scope
+    void ExploreCatchingErrors(Search& search, Grid& grid, FoundPositions& foundPositions, int depth) const;
+    void ExploreInNewTask(Search& search, Grid grid, FoundPositions foundPositions, int depth) const;
+    // Returns true when the search is stopped
+    bool VisitSolution(Search& search, Grid const& grid) const;
+
+    std::unique_ptr<TGridSolverWithoutHypothesis> m_GridSolverWithoutHypothesis;
+    std::unique_ptr<TBranchingStrategy> m_BranchingStrategy;
+    std::shared_ptr<ThreadPool> m_ThreadPool;
+    const ParallelSearch m_ParallelSearch;
+};
+
+template<typename TGridSolverWithoutHypothesis, typename TBranchingStrategy>
+ParallelGridSolverWithHypothesisImpl<TGridSolverWithoutHypothesis, TBranchingStrategy>::ParallelGridSolverWithHypothesisImpl(
+        std::unique_ptr<TGridSolverWithoutHypothesis> gridSolverWithoutHypothesis,
+        std::unique_ptr<TBranchingStrategy> branchingStrategy,
+        std::shared_ptr<ThreadPool> threadPool,
+        ParallelSearch const& parallelSearch) :
+    m_GridSolverWithoutHypothesis(std::move(gridSolverWithoutHypothesis)),
+    m_BranchingStrategy(std::move(branchingStrategy)),
+    m_ThreadPool(std::move(threadPool)),
+    m_ParallelSearch(parallelSearch)
+{}
+
+template<typename TGridSolverWithoutHypothesis, typename TBranchingStrategy>
+bool ParallelGridSolverWithHypothesisImpl<TGridSolverWithoutHypothesis, TBranchingStrategy>::Solve(Grid& grid) const
+{
+    // The grid is only read before the search starts
+    const auto solutionsCount = EnumerateSolutions(grid, [&grid](Grid const& solution)
+        {
+            grid = solution;
+            return false;
+        });
+
+    return solutionsCount > 0;
+}
+
+template<typename TGridSolverWithoutHypothesis, typename TBranchingStrategy>
+int ParallelGridSolverWithHypothesisImpl<TGridSolverWithoutHypothesis, TBranchingStrategy>::CountSolutions(Grid const& grid, int limit) const
+{
+    if (limit <= 0)
+        return 0;
+
+    return static_cast<int>(EnumerateSolutions(grid, [solutionsCount = 0, limit](Grid const&) mutable { return ++solutionsCount < limit; }));
+}
+
+template<typename TGridSolverWithoutHypothesis, typename TBranchingStrategy>
+std::int64_t ParallelGridSolverWithHypothesisImpl<TGridSolverWithoutHypothesis, TBranchingStrategy>::EnumerateSolutions(
+        Grid const& grid, SolutionVisitor const& visitor) const
+{
+    Search search {visitor};
+
+    Grid rootGrid {grid};
+    FoundPositions foundPositions;
+    detail::GetFoundPositions(rootGrid, foundPositions);
+
+    ExploreCatchingErrors(search, rootGrid, foundPositions, 0);
+
+    m_ThreadPool->RunTasksUntil([&search]{ return search.m_TasksCount == 0; });
+
+    if (search.m_Error)
+        std::rethrow_exception(search.m_Error);
+
+    return search.m_SolutionsCount;
+}
+
+template<typename TGridSolverWithoutHypothesis, typename TBranchingStrategy>
+void ParallelGridSolverWithHypothesisImpl<TGridSolverWithoutHypothesis, TBranchingStrategy>::Explore(
+        Search& search, Grid& grid, FoundPositions& foundPositions, int depth) const
+{
+    if (search.m_Stopped)
+        return;
+
+    if (depth >= m_ParallelSearch.m_SplitDepth || grid.GetUnsetCellsCount() < m_ParallelSearch.m_SplitMinUnsetCells)
+    {
+        Trail trail {grid.GetCellsCount()};
+        ScopedTrail scopedTrail {grid, trail};
+
+        auto onSolution = [this, &search](Grid const& solution){ return VisitSolution(search, solution); };
+        auto stopRequested = [&search]{ return search.m_Stopped.load(std::memory_order_relaxed); };
+
+        detail::SearchWithHypothesis(grid, foundPositions, *m_GridSolverWithoutHypothesis, *m_BranchingStrategy, onSolution, stopRequested);
+
+        return;
+    }
+
+    auto status = m_GridSolverWithoutHypothesis->Solve(grid, foundPositions);
+
+    if (status == GridStatus::SolvedCorrectly)
+        VisitSolution(search, grid);
+
+    if (status != GridStatus::Incomplete)
+        return;
+
+    const auto branch = m_BranchingStrategy->SelectBranch(grid);
+
+    // Each hypothesis but the last is given to a new task, without the hypotheses given before it,
+    // so that the tasks explore distinct grids as the sequential search would
+    while (detail::CountHypothesesLeft(grid, branch) > 1)
+    {
+        const auto hypothesis = m_BranchingStrategy->SelectHypothesis(grid, branch);
+
+        Grid hypothesisGrid {grid};
+        FoundPositions hypothesisFoundPositions {foundPositions};
+        detail::SetHypotheticCellValue(hypothesisGrid, hypothesisFoundPositions, hypothesis.m_Position, hypothesis.m_Value);
+
+        ExploreInNewTask(search, std::move(hypothesisGrid), std::move(hypothesisFoundPositions), depth + 1);
+
+        detail::RemoveWrongHypotheticCellValue(grid, foundPositions, branch, hypothesis);
+    }
+
+    const auto lastHypothesis = m_BranchingStrategy->SelectHypothesis(grid, branch);
+    detail::SetHypotheticCellValue(grid, foundPositions, lastHypothesis.m_Position, lastHypothesis.m_Value);
+
+    Explore(search, grid, foundPositions, depth + 1);
+}
+
+template<typename TGridSolverWithoutHypothesis, typename TBranchingStrategy>
+void ParallelGridSolverWithHypothesisImpl<TGridSolverWithoutHypothesis, TBranchingStrategy>::ExploreCatchingErrors(
+        Search& search, Grid& grid, FoundPositions& foundPositions, int depth) const
+{
+    try
+    {
+        Explore(search, grid, foundPositions, depth);
+    }
+    catch (...)
+    {
+        std::lock_guard<std::mutex> lock(search.m_ErrorMutex);
+
+        if (!search.m_Error)
+            search.m_Error = std::current_exception();
+
+        search.m_Stopped = true;
+    }
+}
+
+template<typename TGridSolverWithoutHypothesis, typename TBranchingStrategy>
+void ParallelGridSolverWithHypothesisImpl<TGridSolverWithoutHypothesis, TBranchingStrategy>::ExploreInNewTask(
+        Search& search, Grid grid, FoundPositions foundPositions, int depth) const
+{
+    search.m_TasksCount++;
+
+    try
+    {
+        m_ThreadPool->Submit([this, &search, grid = std::move(grid), foundPositions = std::move(foundPositions), depth]() mutable
+            {
+                ExploreCatchingErrors(search, grid, foundPositions, depth);
+
+                if (--search.m_TasksCount == 0)
+                    m_ThreadPool->WakeUp();
+            });
+    }
+    catch (...)
+    {
+        // The task was never queued, the caller is still running so the count can't reach 0 here
+        search.m_TasksCount--;
+        throw;
+    }
+}
+
+template<typename TGridSolverWithoutHypothesis, typename TBranchingStrategy>
+bool ParallelGridSolverWithHypothesisImpl<TGridSolverWithoutHypothesis, TBranchingStrategy>::VisitSolution(Search& search, Grid const& grid) const
+{
+    std::lock_guard<std::mutex> lock(search.m_VisitorMutex);
+
+    if (search.m_Stopped)
+        return true;
+
+    search.m_SolutionsCount++;
+
+    if (!search.m_Visitor(grid))
+        search.m_Stopped = true;
+
+    return search.m_Stopped;
+}
+
+} /* namespace sudoku */
@@ -0,0 +1,375 @@
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <stdexcept>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+#include "Value.hpp"
+#include "Deductions.hpp"
+#include "FoundPositions.hpp"
+#include "Grid.hpp"
+#include "GridSize.hpp"
+#include "GridUnits.hpp"
+
+namespace sudoku
+{
+
+class PatternPossibilitiesRemover
+{
+public:
+    virtual ~PatternPossibilitiesRemover() = default;
+
+    // Removes the possibilities excluded by the first deduction, in their order, which applies somewhere in the grid,
+    // the cells left with a single possibility are added to foundPositions.
+    // Returns false if the grid is found in a contradictory state
+    virtual bool RemovePossibilities(Grid& grid, FoundPositions& foundPositions, bool& possibilitiesRemoved) const = 0;
+};
+
+template<int TGridSize>
+class PatternPossibilitiesRemoverImpl final : public PatternPossibilitiesRemover
+{
+public:
+    PatternPossibilitiesRemoverImpl(Deductions const& deductions);
+
+    bool RemovePossibilities(Grid& grid, FoundPositions& foundPositions, bool& possibilitiesRemoved) const override;
+
+private:
+    Deductions m_Deductions;
+};
+
+namespace detail
+{
+
+inline bool RemovePossibilityFromCell(Grid& grid, int index, Value value, FoundPositions& foundPositions, int& removedCount)
+{
+    if (!grid.RemovePossibility(index, value))
+        return false;
+
+    if (grid.GetPossibilities(index).OnlyOnePossibilityLeft())
+        foundPositions.push(grid.GetPosition(index));
+
+    removedCount++;
+
+    return true;
+}
+
+// Only the slots where the value is still possible are changed
+inline bool RemoveValueFromSlots(Grid& grid, int unit, UnitSlotsBitSet slots, Value value, FoundPositions& foundPositions, int& removedCount)
+{
+    for (slots &= grid.GetValueLocations(unit, value); slots != 0; slots &= slots - 1)
+    {
+        const auto index = grid.GetUnits().GetCellIndex(unit, __builtin_ctz(slots));
+
+        if (!RemovePossibilityFromCell(grid, index, value, foundPositions, removedCount))
+            return false;
+    }
+
+    return true;
+}
+
+template<int TGridSize>
+struct UnitShape
+{
+    static constexpr int BlockRows {GetBlockRows(TGridSize)};
+    static constexpr int BlockCols {GetBlockCols(TGridSize)};
+    static constexpr int BlocksPerRow {TGridSize / BlockCols};
+
+    static constexpr auto AllSlots = (UnitSlotsBitSet{1} << TGridSize) - 1;
+
+    // Slots of the first row of a block, or of the first block of a row
+    static constexpr auto BlockRowSlots = (UnitSlotsBitSet{1} << BlockCols) - 1;
+
+    // Slots of the first block of a column
+    static constexpr auto ColumnBlockSlots = (UnitSlotsBitSet{1} << BlockRows) - 1;
+
+    // Slots of the first column of a block
+    static constexpr UnitSlotsBitSet BlockColSlots = []
+        {
+            UnitSlotsBitSet slots {0};
+
+            for (int row = 0; row < BlockRows; row++)
+                slots |= UnitSlotsBitSet{1} << (row * BlockCols);
+
+            return slots;
+        }();
+
+    static constexpr int GetRowUnit(int row) { return TGridSize + row; }
+    static constexpr int GetBlockUnit(int block) { return 2 * TGridSize + block; }
+    static constexpr int GetBlock(int row, int col) { return (row / BlockRows) * BlocksPerRow + col / BlockCols; }
+};
+
+// Pointing: a value of a block confined to one of its rows or columns is removed from the rest of that row or column.
+// Claiming: a value of a row or column confined to one block is removed from the rest of that block.
+template<int TGridSize>
+bool RemoveLockedCandidates(Grid& grid, FoundPositions& foundPositions, int& removedCount)
+{
+    using Shape = UnitShape<TGridSize>;
+    constexpr auto allValues = (PossibilitiesBitSet{1} << TGridSize) - 1;
+
+    for (int block = 0; block < TGridSize; block++)
+    {
+        const auto blockUnit = Shape::GetBlockUnit(block);
+        const auto firstRow = (block / Shape::BlocksPerRow) * Shape::BlockRows;
+        const auto firstCol = (block % Shape::BlocksPerRow) * Shape::BlockCols;
+
+        for (auto values = allValues & ~grid.GetPlacedValues(blockUnit); values != 0; values &= values - 1)
+        {
+            const Value value = __builtin_ctz(values) + 1;
+            const auto slots = grid.GetValueLocations(blockUnit, value);
+
+            if (slots == 0)
+                continue;
+
+            const auto blockRow = __builtin_ctz(slots) / Shape::BlockCols;
+            const auto blockCol = __builtin_ctz(slots) % Shape::BlockCols;
+
+            if ((slots & ~(Shape::BlockRowSlots << (blockRow * Shape::BlockCols))) == 0
+                    && !RemoveValueFromSlots(grid, Shape::GetRowUnit(firstRow + blockRow), Shape::AllSlots & ~(Shape::BlockRowSlots << firstCol),
+                                             value, foundPositions, removedCount))
+                return false;
+
+            if ((slots & ~(Shape::BlockColSlots << blockCol)) == 0
+                    && !RemoveValueFromSlots(grid, firstCol + blockCol, Shape::AllSlots & ~(Shape::ColumnBlockSlots << firstRow),
+                                             value, foundPositions, removedCount))
+                return false;
+        }
+    }
+
+    for (int row = 0; row < TGridSize; row++)
+    {
+        const auto rowUnit = Shape::GetRowUnit(row);
+
+        for (auto values = allValues & ~grid.GetPlacedValues(rowUnit); values != 0; values &= values - 1)
+        {
+            const Value value = __builtin_ctz(values) + 1;
+            const auto slots = grid.GetValueLocations(rowUnit, value);
+
+            if (slots == 0)
+                continue;
+
+            const auto firstCol = __builtin_ctz(slots) / Shape::BlockCols * Shape::BlockCols;
+
+            if ((slots & ~(Shape::BlockRowSlots << firstCol)) != 0)
+                continue;
+
+            const auto rowSlots = Shape::BlockRowSlots << ((row % Shape::BlockRows) * Shape::BlockCols);
+
+            if (!RemoveValueFromSlots(grid, Shape::GetBlockUnit(Shape::GetBlock(row, firstCol)), Shape::AllSlots & ~rowSlots,
+                                      value, foundPositions, removedCount))
+                return false;
+        }
+    }
+
+    for (int col = 0; col < TGridSize; col++)
+    {
+        for (auto values = allValues & ~grid.GetPlacedValues(col); values != 0; values &= values - 1)
+        {
+            const Value value = __builtin_ctz(values) + 1;
+            const auto slots = grid.GetValueLocations(col, value);
+
+            if (slots == 0)
+                continue;
+
+            const auto firstRow = __builtin_ctz(slots) / Shape::BlockRows * Shape::BlockRows;
+
+            if ((slots & ~(Shape::ColumnBlockSlots << firstRow)) != 0)
+                continue;
+
+            const auto colSlots = Shape::BlockColSlots << (col % Shape::BlockCols);
+
+            if (!RemoveValueFromSlots(grid, Shape::GetBlockUnit(Shape::GetBlock(firstRow, col)), Shape::AllSlots & ~colSlots,
+                                      value, foundPositions, removedCount))
+                return false;
+        }
+    }
+
+    return true;
+}
+
+// Possibilities of the cells of a unit, or cells of the values of a unit, with two or three bits set
+struct SubsetCandidates
+{
+    std::array<std::uint32_t, MaxGridSize> m_Members;
+    std::array<std::uint32_t, MaxGridSize> m_BitSets;
+    int m_Count {0};
+
+    void AddIfSmall(int member, std::uint32_t bitSet)
+    {
+        const auto count = __builtin_popcount(bitSet);
+
+        if (count < 2 || count > 3)
+            return;
+
+        m_Members[m_Count] = std::uint32_t{1} << member;
+        m_BitSets[m_Count] = bitSet;
+        m_Count++;
+    }
+
+    // Calls onSubset(members, bitSets) for each pair or triple whose bit sets hold as many bits as members.
+    // Returns false if fewer bits than members are found, or if onSubset does.
+    template<typename TOnSubset>
+    bool ForEachSubset(TOnSubset&& onSubset) const
+    {
+        for (int i = 0; i < m_Count; i++)
+        {
+            for (int j = i + 1; j < m_Count; j++)
+            {
+                const auto pairBitSet = m_BitSets[i] | m_BitSets[j];
+
+                if (__builtin_popcount(pairBitSet) == 2 && !onSubset(m_Members[i] | m_Members[j], pairBitSet))
+                    return false;
+
+                for (int k = j + 1; k < m_Count; k++)
+                {
+                    const auto tripleBitSet = pairBitSet | m_BitSets[k];
+                    const auto count = __builtin_popcount(tripleBitSet);
+
+                    if (count < 3 || (count == 3 && !onSubset(m_Members[i] | m_Members[j] | m_Members[k], tripleBitSet)))
+                        return false;
+                }
+            }
+        }
+
+        return true;
+    }
+};
+
+// Cells of a unit holding between them as many values as cells: the values are removed from the other cells of the unit
+template<int TGridSize>
+bool RemoveNakedSubsets(Grid& grid, FoundPositions& foundPositions, int& removedCount)
+{
+    using Shape = UnitShape<TGridSize>;
+
+    for (int unit = 0; unit < GridUnits::UnitsPerCell * TGridSize; unit++)
+    {
+        SubsetCandidates cells;
+
+        for (int slot = 0; slot < TGridSize; slot++)
+            cells.AddIfSmall(slot, grid.GetPossibilities(grid.GetUnits().GetCellIndex(unit, slot)).GetBitSet());
+
+        const auto removeValues = [&grid, &foundPositions, &removedCount, unit](UnitSlotsBitSet slots, PossibilitiesBitSet values)
+            {
+                for (; values != 0; values &= values - 1)
+                {
+                    if (!RemoveValueFromSlots(grid, unit, Shape::AllSlots & ~slots, __builtin_ctz(values) + 1, foundPositions, removedCount))
+                        return false;
+                }
+
+                return true;
+            };
+
+        if (!cells.ForEachSubset(removeValues))
+            return false;
+    }
+
+    return true;
+}
+
+// Values of a unit confined between them to as many cells as values: the other values are removed from these cells
+template<int TGridSize>
+bool RemoveHiddenSubsets(Grid& grid, FoundPositions& foundPositions, int& removedCount)
+{
+    constexpr auto allValues = (PossibilitiesBitSet{1} << TGridSize) - 1;
+
+    for (int unit = 0; unit < GridUnits::UnitsPerCell * TGridSize; unit++)
+    {
+        SubsetCandidates values;
+
+        for (auto unplacedValues = allValues & ~grid.GetPlacedValues(unit); unplacedValues != 0; unplacedValues &= unplacedValues - 1)
+        {
+            const auto valueIndex = __builtin_ctz(unplacedValues);
+            values.AddIfSmall(valueIndex, grid.GetValueLocations(unit, valueIndex + 1));
+        }
+
+        const auto removeOtherValues = [&grid, &foundPositions, &removedCount, unit](PossibilitiesBitSet subsetValues, UnitSlotsBitSet slots)
+            {
+                for (; slots != 0; slots &= slots - 1)
+                {
+                    const auto index = grid.GetUnits().GetCellIndex(unit, __builtin_ctz(slots));
+
+                    for (auto otherValues = grid.GetPossibilities(index).GetBitSet() & ~subsetValues; otherValues != 0; otherValues &= otherValues - 1)
+                    {
+                        if (!RemovePossibilityFromCell(grid, index, __builtin_ctz(otherValues) + 1, foundPositions, removedCount))
+                            return false;
+                    }
+                }
+
+                return true;
+            };
+
+        if (!values.ForEachSubset(removeOtherValues))
+            return false;
+    }
+
+    return true;
+}
+
+template<int TGridSize>
+bool RemovePossibilities(Deduction deduction, Grid& grid, FoundPositions& foundPositions, int& removedCount)
+{
+    switch (deduction)
+    {
+    case Deduction::LockedCandidates : return RemoveLockedCandidates<TGridSize>(grid, foundPositions, removedCount);
+    case Deduction::NakedSubsets : return RemoveNakedSubsets<TGridSize>(grid, foundPositions, removedCount);
+    case Deduction::HiddenSubsets : return RemoveHiddenSubsets<TGridSize>(grid, foundPositions, removedCount);
+    }
+
+    throw std::runtime_error("Unknown deduction");
+}
+
+inline std::uint64_t ReadCycleCounter()
+{
+#if defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#else
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+#endif
+}
+
+} // namespace detail
+
+template<int TGridSize>
+PatternPossibilitiesRemoverImpl<TGridSize>::PatternPossibilitiesRemoverImpl(Deductions const& deductions) :
+    m_Deductions(deductions)
+{}
+
+template<int TGridSize>
+bool PatternPossibilitiesRemoverImpl<TGridSize>::RemovePossibilities(Grid& grid, FoundPositions& foundPositions, bool& possibilitiesRemoved) const
+{
+    possibilitiesRemoved = false;
+
+    for (auto deduction : m_Deductions.m_Order)
+    {
+        const auto start = m_Deductions.m_Profile ? detail::ReadCycleCounter() : 0;
+
+        int removedCount {0};
+        const auto consistent = detail::RemovePossibilities<TGridSize>(deduction, grid, foundPositions, removedCount);
+
+        if (m_Deductions.m_Profile)
+        {
+            auto& profile = (*m_Deductions.m_Profile)[static_cast<int>(deduction)];
+
+            profile.m_Tries++;
+            profile.m_Hits += removedCount != 0;
+            profile.m_PossibilitiesRemoved += removedCount;
+            profile.m_Cycles += detail::ReadCycleCounter() - start;
+        }
+
+        if (!consistent)
+            return false;
+
+        if (removedCount != 0)
+        {
+            possibilitiesRemoved = true;
+            return true;
+        }
+    }
+
+    return true;
+}
+
+} /* namespace sudoku */
@@ -1,7 +1,7 @@
 #pragma once
 
-#include <unordered_set>
-#include <bitset>
+#include <cstdint>
+#include <optional>
 
 #include "Value.hpp"
 #include "Constants.hpp"
@@ -9,41 +9,59 @@
 namespace sudoku
 {
 
-using PossibilitiesBitSet = std::bitset<MaxGridSize>;
+// Bit i set means value i + 1 is still possible
+using PossibilitiesBitSet = std::uint32_t;
+
+static_assert(MaxGridSize <= 32, "PossibilitiesBitSet can't hold MaxGridSize possibilities");
 
 class Possibilities
 {
 public:
+    // Left uninitialised, so that grids can be allocated without touching all their cells
+    Possibilities() = default;
     Possibilities(int gridSize);
-    Possibilities(PossibilitiesBitSet const& possibilities);
+    Possibilities(PossibilitiesBitSet const& possibilities) : m_Possibilities(possibilities) {}
 
     Possibilities(Possibilities const& possibilities) = default;
     Possibilities& operator=(Possibilities const& possibilities) = default;
 
-    void RemovePossibility(Value const& value);
+    void RemovePossibility(Value const& value) { m_Possibilities &= ~ValueBit(value); }
 
     void SetValue(Value const& value);
 
     std::optional<Value> GetValue() const;
 
-    int Count() const;
+    int Count() const { return __builtin_popcount(m_Possibilities); }
 
-    bool OnlyOnePossibilityLeft() const;
+    // Cheaper than Count() == 1: clearing the lowest bit leaves nothing
+    bool OnlyOnePossibilityLeft() const { return m_Possibilities != 0 && (m_Possibilities & (m_Possibilities - 1)) == 0; }
 
-    bool operator==(Possibilities const& other) const;
+    bool operator==(Possibilities const& other) const { return m_Possibilities == other.m_Possibilities; }
 
-    bool operator==(PossibilitiesBitSet const& possibilities) const;
+    bool operator==(PossibilitiesBitSet const& possibilities) const { return m_Possibilities == possibilities; }
 
-    Value GetPossibilityLeft() const;
+    // Highest value still possible, 0 if none
+    Value GetPossibilityLeft() const { return m_Possibilities == 0 ? 0 : 32 - __builtin_clz(m_Possibilities); }
 
-    bool Contains(Value value) const;
+    // Lowest value still possible, 0 if none
+    Value GetLowestPossibilityLeft() const { return m_Possibilities == 0 ? 0 : __builtin_ctz(m_Possibilities) + 1; }
 
-    PossibilitiesBitSet const& GetBitSet() const;
+    bool Contains(Value value) const { return (m_Possibilities & ValueBit(value)) != 0; }
 
-private:
-    bool OnlyOnePossibilityLeftImpl() const;
+    PossibilitiesBitSet const& GetBitSet() const { return m_Possibilities; }
 
+    static PossibilitiesBitSet ValueBit(Value value) { return PossibilitiesBitSet{1} << (value - 1); }
+
+private:
     PossibilitiesBitSet m_Possibilities;
 };
 
+inline std::optional<Value> Possibilities::GetValue() const
+{
+    if (!OnlyOnePossibilityLeft())
+        return {};
+
+    return GetLowestPossibilityLeft();
+}
+
 } // namespace sudoku
@@ -1,32 +1,78 @@
 #pragma once
 
 #include <memory>
+#include <sstream>
 
 #include "FoundPositions.hpp"
-#include "RelatedPositionsGetter.hpp"
+#include "Grid.hpp"
+#include "GridUnits.hpp"
+#include "Position.hpp"
+#include "Value.hpp"
 
 namespace sudoku
 {
 
-class Grid;
-class Position;
-
 class RelatedPossibilitiesRemover
 {
 public:
     virtual ~RelatedPossibilitiesRemover() = default;
 
-    virtual void UpdateRelatedPossibilities(Position const& newFoundPosition, Grid& grid, FoundPositions& foundPositions) const = 0;
+    // Returns false if the update leads to a contradiction in the grid
+    virtual bool UpdateRelatedPossibilities(Position const& newFoundPosition, Grid& grid, FoundPositions& foundPositions) const = 0;
 };
 
-class RelatedPossibilitiesRemoverImpl : public RelatedPossibilitiesRemover
+template<int TGridSize>
+class RelatedPossibilitiesRemoverImpl final : public RelatedPossibilitiesRemover
 {
 public:
-    void UpdateRelatedPossibilities(Position const& newFoundPosition, Grid& grid, FoundPositions& foundPositions) const override;
-
-private:
-    const RelatedPositionsGetterImpl m_RelatedPositionsGetter;
+    bool UpdateRelatedPossibilities(Position const& newFoundPosition, Grid& grid, FoundPositions& foundPositions) const override;
 };
 
-} /* namespace sudoku */
+namespace detail
+{
+
+// A related cell already set with the found value has no possibility left once it is removed
+inline bool RemoveValueFromOtherCellsOfUnit(Grid& grid, GridUnits::CellSlot const& cellSlot, Value foundValue, FoundPositions& foundPositions)
+{
+    auto const& units = grid.GetUnits();
+
+    const auto otherSlots = grid.GetValueLocations(cellSlot.m_Unit, foundValue) & ~(UnitSlotsBitSet{1} << cellSlot.m_Slot);
+
+    for (auto slots = otherSlots; slots != 0; slots &= slots - 1)
+    {
+        const auto index = units.GetCellIndex(cellSlot.m_Unit, __builtin_ctz(slots));
+
+        if (!grid.RemovePossibility(index, foundValue))
+            return false;
 
+        if (grid.GetPossibilities(index).OnlyOnePossibilityLeft())
+            foundPositions.push(grid.GetPosition(index));
+    }
+
+    return true;
+}
+
+} // namespace detail
+
+template<int TGridSize>
+bool RelatedPossibilitiesRemoverImpl<TGridSize>::UpdateRelatedPossibilities(Position const& newFoundPosition, Grid& grid, FoundPositions& foundPositions) const
+{
+    const auto foundValue = grid.GetCell(newFoundPosition).GetValue();
+
+    if (!foundValue)
+    {
+        std::stringstream error;
+        error << "Can't update grid possibilities because: cell '" << newFoundPosition << "' has no value set";
+        throw std::runtime_error(error.str());
+    }
+
+    for (auto const& cellSlot : grid.GetUnits().GetCellSlots(grid.GetIndex(newFoundPosition)))
+    {
+        if (!detail::RemoveValueFromOtherCellsOfUnit(grid, cellSlot, *foundValue, foundPositions))
+            return false;
+    }
+
+    return true;
+}
+
+} /* namespace sudoku */
@@ -0,0 +1,281 @@
+#pragma once
+
+#include <array>
+
+#include "Position.hpp"
+#include "GridSize.hpp"
+#include "RelatedPositionsGetter.hpp"
+
+namespace sudoku
+{
+
+namespace detail
+{
+
+template<int TPositionsCount, int TGroupsCount>
+std::array<Range<Position>, TGroupsCount> CreateArrayOfRanges(std::array<std::array<Position, TPositionsCount>, TGroupsCount> const& allGroupsPositions)
+{
+    std::array<Range<Position>, TGroupsCount> ranges {};
+
+    auto it = ranges.begin();
+
+    for (auto const& group : allGroupsPositions)
+    {
+        *it = Range<Position> {group};
+        it++;
+    }
+
+    return ranges;
+}
+
+template<int TGridSize, int TGroupSize>
+struct Ranges
+{
+    Ranges(std::array<std::array<Position, TGridSize>, TGroupSize> allGroupsPositions) :
+        m_AllGroupsPositions(allGroupsPositions),
+        m_ArrayOfRanges(CreateArrayOfRanges<TGridSize, TGroupSize>(m_AllGroupsPositions)),
+        m_Ranges(m_ArrayOfRanges)
+    {}
+
+    Range<Position> const& operator[](int i) const { return m_Ranges[i]; }
+
+    std::array<std::array<Position, TGridSize>, TGroupSize> m_AllGroupsPositions;
+    std::array<Range<Position>, TGroupSize> m_ArrayOfRanges;
+    Range<Range<Position>> m_Ranges;
+};
+
+
+template<class Range>
+bool any_of_equal(Range range, typename Range::value_type comp)
+{
+    for (auto val : range)
+    {
+        if (val == comp)
+            return true;
+    }
+
+    return false;
+}
+
+constexpr int RoundDown(int value, int multiplier)
+{
+    return (value / multiplier) * multiplier;
+}
+
+template<int TGridSize>
+std::array<Position, TGridSize> GetAllPositions(
+        int begRow,
+        int rows,
+        int begCol,
+        int cols)
+{
+    std::array<Position, TGridSize> related {};
+    auto relatedIter = related.begin();
+
+    for(int row = begRow; row < begRow + rows; row++)
+    {
+        for(int col = begCol; col < begCol + cols; col++)
+        {
+            *relatedIter = Position {row, col};
+            relatedIter++;
+        }
+    }
+
+    return related;
+}
+
+template<int TGridSize>
+std::array<Position, GetNumberOfRelatedPositionInGroup(TGridSize)> GetAllPositionsButSelectedOne(
+        int begRow,
+        int rows,
+        int begCol,
+        int cols,
+        Position const& currentPosition)
+{
+    std::array<Position, GetNumberOfRelatedPositionInGroup(TGridSize)> related {};
+
+    auto relatedIter = related.begin();
+
+    for (auto const& pos : GetAllPositions<TGridSize>(begRow, rows, begCol, cols))
+    {
+        if (pos == currentPosition)
+            continue;
+
+        *relatedIter = pos;
+        relatedIter++;
+    }
+
+    return related;
+}
+
+template<int TGridSize>
+std::array<Position, GetNumberOfRelatedPositionInGroup(TGridSize)> CreateVerticalRelatedPositions(Position const& currentPosition)
+{
+    return GetAllPositionsButSelectedOne<TGridSize>(0, TGridSize, currentPosition.m_Col, 1, currentPosition);
+}
+
+template<int TGridSize>
+std::array<Position, GetNumberOfRelatedPositionInGroup(TGridSize)> CreateHorizontalRelatedPositions(Position const& currentPosition)
+{
+    return GetAllPositionsButSelectedOne<TGridSize>(currentPosition.m_Row, 1, 0, TGridSize, currentPosition);
+}
+
+template<int TGridSize>
+std::array<Position, GetNumberOfRelatedPositionInGroup(TGridSize)> CreateBlockRelatedPositions(Position const& currentPosition)
+{
+    constexpr auto blockRows = GetBlockRows(TGridSize);
+    constexpr auto blockCols = GetBlockCols(TGridSize);
+
+    auto beginRow = RoundDown(currentPosition.m_Row, blockRows);
+    auto beginCol = RoundDown(currentPosition.m_Col, blockCols);
+    return GetAllPositionsButSelectedOne<TGridSize>(beginRow, blockRows, beginCol, blockCols, currentPosition);
+}
+
+template<int TGridSize>
+std::array<Position, GetAllRelatedPositionNumber(TGridSize)> CreateAllRelatedPositions(Position const& currentPosition)
+{
+    std::array<Position, GetAllRelatedPositionNumber(TGridSize)> allRelatedWithoutDuplication {};
+
+    auto it = allRelatedWithoutDuplication.begin();
+
+    for (auto const& relatedPositions : {CreateVerticalRelatedPositions<TGridSize>(currentPosition), CreateHorizontalRelatedPositions<TGridSize>(currentPosition), CreateBlockRelatedPositions<TGridSize>(currentPosition)})
+    {
+        for (auto const& pos : relatedPositions)
+        {
+            if (!any_of_equal(allRelatedWithoutDuplication, pos))
+            {
+                *it = pos;
+                it++;
+            }
+        }
+    }
+
+    return allRelatedWithoutDuplication;
+}
+
+constexpr int PosToInt(Position const& position, int gridSize)
+{
+    return position.m_Row * gridSize + position.m_Col;
+}
+
+template<int TGridSize, int TRelatedPosCount, typename Fun>
+std::array<std::array<Position, TRelatedPosCount>, TGridSize * TGridSize> CreateAllRelatedPositionsGroups(Fun GetRelatedPosition)
+{
+    std::array<std::array<Position, TRelatedPosCount>, TGridSize * TGridSize> allRelatedPositionsGroups {};
+
+    for(int row = 0; row < TGridSize; row++)
+    {
+        for(int col = 0; col < TGridSize; col++)
+        {
+            Position pos {row, col};
+
+            allRelatedPositionsGroups[PosToInt(pos, TGridSize)] = GetRelatedPosition(pos);
+        }
+    }
+
+    return allRelatedPositionsGroups;
+}
+
+template<int TGridSize>
+struct AllRelatedPositionsGroups
+{
+    Ranges<TGridSize - 1, TGridSize * TGridSize> m_Vertical = CreateAllRelatedPositionsGroups<TGridSize, TGridSize - 1>(CreateVerticalRelatedPositions<TGridSize>);
+    Ranges<TGridSize - 1, TGridSize * TGridSize> m_Horizontal = CreateAllRelatedPositionsGroups<TGridSize, TGridSize - 1>(CreateHorizontalRelatedPositions<TGridSize>);
+    Ranges<TGridSize - 1, TGridSize * TGridSize> m_Block = CreateAllRelatedPositionsGroups<TGridSize, TGridSize - 1>(CreateBlockRelatedPositions<TGridSize>);
+
+    Ranges<GetAllRelatedPositionNumber(TGridSize), TGridSize * TGridSize> m_All = CreateAllRelatedPositionsGroups<TGridSize, GetAllRelatedPositionNumber(TGridSize)>(CreateAllRelatedPositions<TGridSize>);
+};
+
+// Tables are generated when the program is loaded, evaluating them at compile time doesn't scale to 25x25 grids
+template<int TGridSize>
+inline const AllRelatedPositionsGroups<TGridSize> AllRelatedPositionsGroupsTable {};
+
+template<int TGridSize>
+std::array<std::array<Position, TGridSize>, GetGroupsNumberInGrid(TGridSize)> CreateAllGroupsPositions()
+{
+    std::array<std::array<Position, TGridSize>, GetGroupsNumberInGrid(TGridSize)> allGroupsPositions {};
+
+    auto it = allGroupsPositions.begin();
+
+    for (int col = 0; col < TGridSize; col++)
+    {
+        *it = GetAllPositions<TGridSize>(0, TGridSize, col, 1);
+        it++;
+    }
+
+    for (int row = 0; row < TGridSize; row++)
+    {
+        *it = GetAllPositions<TGridSize>(row, 1, 0, TGridSize);
+        it++;
+    }
+
+    constexpr int blockRows = GetBlockRows(TGridSize);
+    constexpr int blockCols = GetBlockCols(TGridSize);
+    for (int row = 0; row < TGridSize; row += blockRows)
+    {
+        for (int col = 0; col < TGridSize; col += blockCols)
+        {
+            *it = GetAllPositions<TGridSize>(row, blockRows, col, blockCols);
+            it++;
+        }
+    }
+
+    return allGroupsPositions;
+}
+
+template<int TGridSize>
+struct AllGroupsPositions
+{
+    Ranges<TGridSize, GetGroupsNumberInGrid(TGridSize)> m_Ranges = CreateAllGroupsPositions<TGridSize>();
+};
+
+template<int TGridSize>
+inline const AllGroupsPositions<TGridSize> AllGroupsPositionsTable {};
+
+} // namespace detail
+
+template<int TGridSize>
+class StaticRelatedPositionsGetter
+{
+    static_assert(HasValidBlocks(TGridSize), "Grid size can't be split in blocks");
+
+public:
+    Range<Position> GetRelatedHorizontalPositions(Position const& selectedPosition) const;
+    Range<Position> GetRelatedVerticalPositions(Position const& selectedPosition) const;
+    Range<Position> GetRelatedBlockPositions(Position const& selectedPosition) const;
+    Range<Position> GetAllRelatedPositions(Position const& selectedPosition) const;
+
+    Range<Range<Position>> GetAllGroupsPositions() const;
+};
+
+template<int TGridSize>
+Range<Position> StaticRelatedPositionsGetter<TGridSize>::GetRelatedHorizontalPositions(Position const& selectedPosition) const
+{
+    return detail::AllRelatedPositionsGroupsTable<TGridSize>.m_Horizontal[detail::PosToInt(selectedPosition, TGridSize)];
+}
+
+template<int TGridSize>
+Range<Position> StaticRelatedPositionsGetter<TGridSize>::GetRelatedVerticalPositions(Position const& selectedPosition) const
+{
+    return detail::AllRelatedPositionsGroupsTable<TGridSize>.m_Vertical[detail::PosToInt(selectedPosition, TGridSize)];
+}
+
+template<int TGridSize>
+Range<Position> StaticRelatedPositionsGetter<TGridSize>::GetRelatedBlockPositions(Position const& selectedPosition) const
+{
+    return detail::AllRelatedPositionsGroupsTable<TGridSize>.m_Block[detail::PosToInt(selectedPosition, TGridSize)];
+}
+
+template<int TGridSize>
+Range<Position> StaticRelatedPositionsGetter<TGridSize>::GetAllRelatedPositions(Position const& selectedPosition) const
+{
+    return detail::AllRelatedPositionsGroupsTable<TGridSize>.m_All[detail::PosToInt(selectedPosition, TGridSize)];
+}
+
+template<int TGridSize>
+Range<Range<Position>> StaticRelatedPositionsGetter<TGridSize>::GetAllGroupsPositions() const
+{
+    return detail::AllGroupsPositionsTable<TGridSize>.m_Ranges.m_Ranges;
+}
+
+} // namespace sudoku
@@ -0,0 +1,271 @@
+#include "StreamGridSolver.hpp"
+
+#include <cstring>
+#include <atomic>
+#include <exception>
+#include <future>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <thread>
+
+#include "BoundedQueue.hpp"
+#include "Grid.hpp"
+#include "GridText.hpp"
+
+using namespace sudoku;
+
+namespace
+{
+
+// Chunks are extended to the end of their last line
+constexpr std::size_t ChunkSize {32 * 1024};
+
+// Per solver thread
+constexpr std::size_t ChunksInFlightPerThread {4};
+
+struct SolvedChunk
+{
+    std::string m_Output;
+    StreamSolveReport m_Report;
+};
+
+// Up to the end of the first line ending after size characters, or the whole text
+std::string_view TakeLines(std::string_view& text, std::size_t size)
+{
+    auto end = text.size();
+
+    if (size < text.size())
+    {
+        const auto lineEnd = static_cast<char const*>(std::memchr(text.data() + size, '\n', text.size() - size));
+
+        if (lineEnd)
+            end = lineEnd - text.data() + 1;
+    }
+
+    const auto lines = text.substr(0, end);
+    text.remove_prefix(end);
+
+    return lines;
+}
+
+// Empty for the lines which aren't grids, the errors of the solver aren't caught with those of the parsing
+std::optional<Grid> TryParseGrid(std::string_view line)
+{
+    try
+    {
+        return ParseGrid(line);
+    }
+    catch (std::runtime_error const&)
+    {
+        return std::nullopt;
+    }
+}
+
+SolvedChunk SolveChunk(GridSolver const& gridSolver, std::string_view text)
+{
+    SolvedChunk solvedChunk;
+
+    // The solutions take as much room as the grids
+    solvedChunk.m_Output.reserve(text.size());
+
+    while (!text.empty())
+    {
+        auto line = TakeLines(text, 0);
+
+        if (line.back() == '\n')
+            line.remove_suffix(1);
+
+        if (!line.empty() && line.back() == '\r')
+            line.remove_suffix(1);
+
+        if (line.empty())
+            continue;
+
+        auto grid = TryParseGrid(line);
+
+        if (!grid)
+            solvedChunk.m_Report.m_InvalidLinesCount++;
+        else
+        {
+            solvedChunk.m_Report.m_GridsCount++;
+
+            if (gridSolver.Solve(*grid))
+            {
+                const auto outputSize = solvedChunk.m_Output.size();
+                solvedChunk.m_Output.resize(outputSize + grid->GetCellsCount());
+                FormatGrid(*grid, solvedChunk.m_Output.data() + outputSize);
+            }
+            else
+                solvedChunk.m_Report.m_UnsolvedGridsCount++;
+        }
+
+        solvedChunk.m_Output += '\n';
+    }
+
+    return solvedChunk;
+}
+
+} // anonymous namespace
+
+struct StreamGridSolverImpl::Chunk
+{
+    // Text read from a stream
+    std::string m_Buffer;
+
+    // Text of an input in memory, when there's no buffer
+    std::string_view m_Text;
+
+    // Not kept in m_Text, which would no longer point to a small buffer once the chunk is moved
+    std::string_view GetText() const { return m_Buffer.empty() ? m_Text : m_Buffer; }
+
+    std::promise<SolvedChunk> m_SolvedChunk;
+};
+
+StreamGridSolverImpl::StreamGridSolverImpl(std::vector<std::unique_ptr<GridSolver>> gridSolvers) :
+    m_GridSolvers(std::move(gridSolvers))
+{
+    if (m_GridSolvers.empty())
+        throw std::runtime_error("A stream grid solver needs at least one grid solver");
+}
+
+StreamSolveReport StreamGridSolverImpl::Solve(std::istream& input, std::ostream& output) const
+{
+    // Characters read after the last line end of the previous chunk
+    std::string partialLine;
+
+    return SolveChunks([&input, &partialLine](Chunk& chunk)
+        {
+            chunk.m_Buffer = std::move(partialLine);
+            partialLine.clear();
+
+            // Reads on until a line end, so that a line longer than a chunk stays whole and is counted once
+            auto lastLineEnd = std::string::npos;
+
+            while (input && lastLineEnd == std::string::npos)
+            {
+                const auto previousSize = chunk.m_Buffer.size();
+                chunk.m_Buffer.resize(previousSize + ChunkSize);
+                input.read(chunk.m_Buffer.data() + previousSize, ChunkSize);
+                chunk.m_Buffer.resize(previousSize + input.gcount());
+
+                // The partial line kept has no line end
+                lastLineEnd = std::string_view(chunk.m_Buffer).substr(previousSize).rfind('\n');
+
+                if (lastLineEnd != std::string::npos)
+                    lastLineEnd += previousSize;
+            }
+
+            if (chunk.m_Buffer.empty())
+                return false;
+
+            if (input)
+            {
+                partialLine = chunk.m_Buffer.substr(lastLineEnd + 1);
+                chunk.m_Buffer.resize(lastLineEnd + 1);
+            }
+
+            return true;
+        },
+        output);
+}
+
+StreamSolveReport StreamGridSolverImpl::Solve(std::string_view input, std::ostream& output) const
+{
+    return SolveChunks([&input](Chunk& chunk)
+        {
+            chunk.m_Text = TakeLines(input, ChunkSize);
+
+            return !chunk.m_Text.empty();
+        },
+        output);
+}
+
+template<typename TReadChunk>
+StreamSolveReport StreamGridSolverImpl::SolveChunks(TReadChunk readChunk, std::ostream& output) const
+{
+    const auto chunksInFlight = ChunksInFlightPerThread * m_GridSolvers.size();
+
+    BoundedQueue<Chunk> chunksToSolve {chunksInFlight};
+
+    // In the order of the input, so that the writer waits for the chunk to write next
+    BoundedQueue<std::future<SolvedChunk>> chunksToWrite {chunksInFlight};
+
+    std::vector<std::thread> solverThreads;
+
+    for (auto const& gridSolver : m_GridSolvers)
+    {
+        solverThreads.emplace_back([&chunksToSolve, &gridSolver]
+            {
+                while (auto chunk = chunksToSolve.Pop())
+                {
+                    try
+                    {
+                        chunk->m_SolvedChunk.set_value(SolveChunk(*gridSolver, chunk->GetText()));
+                    }
+                    catch (...)
+                    {
+                        chunk->m_SolvedChunk.set_exception(std::current_exception());
+                    }
+                }
+            });
+    }
+
+    StreamSolveReport report;
+
+    // First error of a grid solver, nothing is written after it and the input is no longer read
+    std::exception_ptr error;
+    std::atomic<bool> failed {false};
+
+    std::thread writerThread([&chunksToWrite, &output, &report, &error, &failed]
+        {
+            while (auto solvedChunkFuture = chunksToWrite.Pop())
+            {
+                if (failed)
+                {
+                    solvedChunkFuture->wait();
+                    continue;
+                }
+
+                SolvedChunk solvedChunk;
+
+                try
+                {
+                    solvedChunk = solvedChunkFuture->get();
+                }
+                catch (...)
+                {
+                    error = std::current_exception();
+                    failed = true;
+                    continue;
+                }
+
+                output.write(solvedChunk.m_Output.data(), solvedChunk.m_Output.size());
+
+                report.m_GridsCount += solvedChunk.m_Report.m_GridsCount;
+                report.m_UnsolvedGridsCount += solvedChunk.m_Report.m_UnsolvedGridsCount;
+                report.m_InvalidLinesCount += solvedChunk.m_Report.m_InvalidLinesCount;
+            }
+        });
+
+    for (Chunk chunk; !failed && readChunk(chunk); chunk = Chunk {})
+    {
+        chunksToWrite.Push(chunk.m_SolvedChunk.get_future());
+        chunksToSolve.Push(std::move(chunk));
+    }
+
+    chunksToSolve.Close();
+    chunksToWrite.Close();
+
+    for (auto& solverThread : solverThreads)
+        solverThread.join();
+
+    writerThread.join();
+
+    output.flush();
+
+    if (error)
+        std::rethrow_exception(error);
+
+    return report;
+}
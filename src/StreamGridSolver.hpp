@@ -0,0 +1,58 @@
+#pragma once
+
+#include <cstddef>
+#include <istream>
+#include <memory>
+#include <ostream>
+#include <string_view>
+#include <vector>
+
+#include "GridSolverWithHypothesis.hpp"
+
+namespace sudoku
+{
+
+struct StreamSolveReport
+{
+    std::size_t m_GridsCount {0};
+    std::size_t m_UnsolvedGridsCount {0};
+    std::size_t m_InvalidLinesCount {0};
+};
+
+class StreamGridSolver
+{
+public:
+    virtual ~StreamGridSolver() = default;
+
+    // Writes the solution of each grid of input on a line of output, in the same order, see ParseGrid for the format.
+    // An empty line is written for the grids without solution and for the lines which aren't grids.
+    // Empty input lines are skipped.
+    // An exception of a grid solver is thrown again once the solver threads are done, nothing is written from its chunk of lines on.
+    virtual StreamSolveReport Solve(std::istream& input, std::ostream& output) const = 0;
+
+    // Same for grids already in memory, such as a MappedFile, which are read without being copied
+    virtual StreamSolveReport Solve(std::string_view input, std::ostream& output) const = 0;
+};
+
+// The calling thread cuts the input into chunks of whole lines, one thread per grid solver solves them
+// and another thread writes them.
+// The number of chunks between reading and writing is bounded, so that the memory used doesn't depend on the input size.
+class StreamGridSolverImpl final : public StreamGridSolver
+{
+public:
+    StreamGridSolverImpl(std::vector<std::unique_ptr<GridSolver>> gridSolvers);
+
+    StreamSolveReport Solve(std::istream& input, std::ostream& output) const override;
+    StreamSolveReport Solve(std::string_view input, std::ostream& output) const override;
+
+private:
+    struct Chunk;
+
+    // readChunk fills the chunk given, and returns false once the input is over
+    template<typename TReadChunk>
+    StreamSolveReport SolveChunks(TReadChunk readChunk, std::ostream& output) const;
+
+    std::vector<std::unique_ptr<GridSolver>> m_GridSolvers;
+};
+
+} /* namespace sudoku */
@@ -0,0 +1,144 @@
+#include "ThreadPool.hpp"
+
+#include <stdexcept>
+
+namespace sudoku
+{
+
+namespace
+{
+
+thread_local ThreadPool const* CurrentPool {nullptr};
+thread_local int CurrentWorkerIndex {-1};
+
+} // anonymous namespace
+
+ThreadPool::ThreadPool(int threadsCount)
+{
+    if (threadsCount < 1)
+        throw std::runtime_error("A thread pool needs at least one thread");
+
+    for (int i = 0; i < threadsCount; i++)
+        m_Workers.push_back(std::make_unique<Worker>());
+
+    for (int i = 0; i < threadsCount; i++)
+        m_Threads.emplace_back([this, i]{ Work(i); });
+}
+
+ThreadPool::~ThreadPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        m_Stopping = true;
+    }
+
+    m_TaskQueued.notify_all();
+
+    for (auto& thread : m_Threads)
+        thread.join();
+}
+
+void ThreadPool::Submit(Task task)
+{
+    auto workerIndex = GetCurrentWorkerIndex();
+
+    if (workerIndex < 0)
+        workerIndex = m_NextWorker++ % m_Workers.size();
+
+    {
+        auto& worker = *m_Workers[workerIndex];
+        std::lock_guard<std::mutex> lock(worker.m_Mutex);
+        worker.m_Tasks.push_back(std::move(task));
+    }
+
+    m_QueuedTasksCount++;
+    WakeUp();
+}
+
+void ThreadPool::RunTasksUntil(std::function<bool()> const& done)
+{
+    const auto workerIndex = GetCurrentWorkerIndex();
+
+    while (!done())
+    {
+        if (TryRunTask(workerIndex))
+            continue;
+
+        std::unique_lock<std::mutex> lock(m_Mutex);
+        m_TaskQueued.wait(lock, [this, &done]{ return m_QueuedTasksCount > 0 || done(); });
+    }
+}
+
+void ThreadPool::WakeUp()
+{
+    // Taking the lock makes sure that a thread which just found nothing to do is already waiting
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+    }
+
+    m_TaskQueued.notify_all();
+}
+
+void ThreadPool::Work(int workerIndex)
+{
+    CurrentPool = this;
+    CurrentWorkerIndex = workerIndex;
+
+    while (true)
+    {
+        if (TryRunTask(workerIndex))
+            continue;
+
+        std::unique_lock<std::mutex> lock(m_Mutex);
+        m_TaskQueued.wait(lock, [this]{ return m_QueuedTasksCount > 0 || m_Stopping; });
+
+        if (m_Stopping && m_QueuedTasksCount == 0)
+            return;
+    }
+}
+
+bool ThreadPool::TryRunTask(int workerIndex)
+{
+    Task task;
+
+    if (workerIndex >= 0)
+    {
+        auto& worker = *m_Workers[workerIndex];
+        std::lock_guard<std::mutex> lock(worker.m_Mutex);
+
+        if (!worker.m_Tasks.empty())
+        {
+            task = std::move(worker.m_Tasks.back());
+            worker.m_Tasks.pop_back();
+        }
+    }
+
+    const int workersCount = m_Workers.size();
+
+    for (int i = 1; !task && i <= workersCount; i++)
+    {
+        auto& worker = *m_Workers[(workerIndex + i + workersCount) % workersCount];
+        std::lock_guard<std::mutex> lock(worker.m_Mutex);
+
+        if (!worker.m_Tasks.empty())
+        {
+            task = std::move(worker.m_Tasks.front());
+            worker.m_Tasks.pop_front();
+        }
+    }
+
+    if (!task)
+        return false;
+
+    m_QueuedTasksCount--;
+    task();
+
+    return true;
+}
+
+int ThreadPool::GetCurrentWorkerIndex() const
+{
+    return CurrentPool == this ? CurrentWorkerIndex : -1;
+}
+
+} // namespace sudoku
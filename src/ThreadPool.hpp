@@ -0,0 +1,66 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace sudoku
+{
+
+// Threads kept alive for the lifetime of the pool, each with its own queue of tasks.
+// A worker runs the tasks it submitted last first, and steals the oldest tasks of the others when it has none left.
+class ThreadPool
+{
+public:
+    using Task = std::function<void()>;
+
+    ThreadPool(int threadsCount);
+    ~ThreadPool();
+
+    ThreadPool(ThreadPool const&) = delete;
+    ThreadPool& operator=(ThreadPool const&) = delete;
+
+    // Queued on the queue of the worker calling it, or spread over the workers when called from another thread.
+    // The task must not throw: its exceptions are to be caught and handed to the thread waiting for it.
+    void Submit(Task task);
+
+    // Runs queued tasks on the calling thread until done() returns true.
+    // Anything making done() true from another thread must call WakeUp() afterwards.
+    void RunTasksUntil(std::function<bool()> const& done);
+
+    void WakeUp();
+
+    int GetThreadsCount() const { return m_Threads.size(); }
+
+    // Index of the worker running on the calling thread, -1 for the threads which are not of the pool
+    int GetCurrentWorkerIndex() const;
+
+private:
+    struct Worker
+    {
+        std::mutex m_Mutex;
+        std::deque<Task> m_Tasks;
+    };
+
+    void Work(int workerIndex);
+
+    // Own newest task first, then the oldest task of the other workers. workerIndex is -1 for other threads.
+    bool TryRunTask(int workerIndex);
+
+    std::vector<std::unique_ptr<Worker>> m_Workers;
+    std::vector<std::thread> m_Threads;
+
+    std::atomic<int> m_QueuedTasksCount {0};
+    std::atomic<unsigned> m_NextWorker {0};
+
+    std::mutex m_Mutex;
+    std::condition_variable m_TaskQueued;
+    bool m_Stopping {false};
+};
+
+} // namespace sudoku
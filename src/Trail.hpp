@@ -0,0 +1,80 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "Possibilities.hpp"
+
+namespace sudoku
+{
+
+// Possibilities of the cells before their modifications, so that a grid can be brought
+// back to a previous state by rewinding only what changed.
+// A cell is recorded only on its first modification after a checkpoint or a roll back.
+class Trail
+{
+public:
+    using Checkpoint = std::size_t;
+
+    Trail(int cellsCount) :
+        m_RecordedInEpoch(cellsCount, 0)
+    {
+        m_Entries.reserve(cellsCount);
+    }
+
+    Checkpoint GetCheckpoint()
+    {
+        StartNewEpoch();
+
+        return m_Entries.size();
+    }
+
+    void Record(int index, Possibilities const& possibilities)
+    {
+        if (m_RecordedInEpoch[index] == m_Epoch)
+            return;
+
+        m_RecordedInEpoch[index] = m_Epoch;
+        m_Entries.push_back({index, possibilities});
+    }
+
+    // Calls restoreCell(index, possibilities) from the most recent entry back to the checkpoint
+    template<typename TRestoreCell>
+    void RollBack(Checkpoint checkpoint, TRestoreCell restoreCell)
+    {
+        while (m_Entries.size() > checkpoint)
+        {
+            auto const& entry = m_Entries.back();
+            restoreCell(entry.m_Index, entry.m_Possibilities);
+            m_Entries.pop_back();
+        }
+
+        StartNewEpoch();
+    }
+
+    std::size_t GetEntriesCount() const { return m_Entries.size(); }
+
+private:
+    void StartNewEpoch()
+    {
+        if (++m_Epoch != 0)
+            return;
+
+        std::fill(m_RecordedInEpoch.begin(), m_RecordedInEpoch.end(), 0);
+        m_Epoch = 1;
+    }
+
+    struct Entry
+    {
+        int m_Index;
+        Possibilities m_Possibilities;
+    };
+
+    std::vector<Entry> m_Entries;
+
+    std::vector<std::uint32_t> m_RecordedInEpoch;
+    std::uint32_t m_Epoch {1};
+};
+
+} // namespace sudoku
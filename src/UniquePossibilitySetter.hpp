@@ -4,32 +4,77 @@
 
 #include "Value.hpp"
 #include "FoundPositions.hpp"
-#include "RelatedPositionsGetter.hpp"
+#include "Grid.hpp"
+#include "GridUnits.hpp"
 
 namespace sudoku
 {
 
-class Grid;
-class UniquePossibilityFinder;
-class PositionIter;
-struct Position;
-
 class UniquePossibilitySetter
 {
 public:
     virtual ~UniquePossibilitySetter() = default;
 
-    virtual void SetCellsWithUniquePossibility(Grid& grid, FoundPositions& foundPositions) const = 0;
+    // Only the groups where a possibility was removed since the previous call are examined
+    // Returns false if a group of the grid is found in a contradictory state
+    virtual bool SetCellsWithUniquePossibility(Grid& grid, FoundPositions& foundPositions) const = 0;
 };
 
-class UniquePossibilitySetterImpl : public UniquePossibilitySetter
+template<int TGridSize>
+class UniquePossibilitySetterImpl final : public UniquePossibilitySetter
 {
 public:
-    void SetCellsWithUniquePossibility(Grid& grid, FoundPositions& foundPositions) const override;
-
-private:
-    const RelatedPositionsGetterImpl m_RelatedPositionsGetter;
+    bool SetCellsWithUniquePossibility(Grid& grid, FoundPositions& foundPositions) const override;
 };
 
-} /* namespace sudoku */
+namespace detail
+{
+
+// A value not set in the unit which has no cell left is a contradiction,
+// one with a single cell left has to be set there
+inline bool SetUniquePossibilitiesInUnit(Grid& grid, int unit, PossibilitiesBitSet allValues, FoundPositions& foundPositions)
+{
+    for (auto values = allValues & ~grid.GetPlacedValues(unit); values != 0; values &= values - 1)
+    {
+        const Value value = __builtin_ctz(values) + 1;
+        const auto slots = grid.GetValueLocations(unit, value);
+
+        if (slots == 0)
+            return false;
+
+        if ((slots & (slots - 1)) != 0)
+            continue;
+
+        const auto index = grid.GetUnits().GetCellIndex(unit, __builtin_ctz(slots));
+
+        grid.SetValue(index, value);
+        foundPositions.push(grid.GetPosition(index));
+    }
 
+    return true;
+}
+
+} // namespace detail
+
+template<int TGridSize>
+bool UniquePossibilitySetterImpl<TGridSize>::SetCellsWithUniquePossibility(Grid& grid, FoundPositions& foundPositions) const
+{
+    constexpr auto allValues = (PossibilitiesBitSet{1} << TGridSize) - 1;
+
+    const auto touchedUnits = grid.TakeTouchedUnits();
+
+    for (int unitKind = 0; unitKind < GridUnits::UnitsPerCell; unitKind++)
+    {
+        for (auto units = touchedUnits[unitKind]; units != 0; units &= units - 1)
+        {
+            const auto unit = unitKind * TGridSize + __builtin_ctz(units);
+
+            if (!detail::SetUniquePossibilitiesInUnit(grid, unit, allValues, foundPositions))
+                return false;
+        }
+    }
+
+    return true;
+}
+
+} /* namespace sudoku */
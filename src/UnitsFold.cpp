@@ -0,0 +1,147 @@
+#include "UnitsFold.hpp"
+
+#include <algorithm>
+
+#include "Grid.hpp"
+#include "GridSize.hpp"
+#include "Lanes.hpp"
+
+namespace sudoku
+{
+
+namespace
+{
+
+using detail::ScalarLanes;
+
+template<typename TLanes>
+void Add(typename TLanes::Type& set, typename TLanes::Type& duplicated, typename TLanes::Type values)
+{
+    duplicated = TLanes::Or(duplicated, TLanes::And(set, values));
+    set = TLanes::Or(set, values);
+}
+
+template<typename TLanes>
+void AddToAccumulators(PossibilitiesBitSet* set, PossibilitiesBitSet* duplicated, typename TLanes::Type values)
+{
+    auto setLanes = TLanes::Load(set);
+    auto duplicatedLanes = TLanes::Load(duplicated);
+
+    Add<TLanes>(setLanes, duplicatedLanes, values);
+
+    TLanes::Store(set, setLanes);
+    TLanes::Store(duplicated, duplicatedLanes);
+}
+
+void Merge(PossibilitiesBitSet& set, PossibilitiesBitSet& duplicated, PossibilitiesBitSet otherSet, PossibilitiesBitSet otherDuplicated)
+{
+    duplicated |= otherDuplicated | (set & otherSet);
+    set |= otherSet;
+}
+
+// The lanes of a vector hold consecutive cells of a row: the columns and the blocks of a band
+// of rows are folded lane by lane, the rows are folded across the lanes
+template<typename TLanes>
+UnitsFold FoldSetValuesWith(Grid const& grid)
+{
+    const auto gridSize = grid.GetGridSize();
+    const auto blockRows = GetBlockRows(gridSize);
+    const auto blockCols = GetBlockCols(gridSize);
+    const auto blocksPerBand = gridSize / blockCols;
+
+    // Only the accumulated units are cleared, the others are written once
+    UnitsFold fold;
+
+    auto* columnsSet = fold.m_SetValues.data();
+    auto* columnsDuplicated = fold.m_DuplicatedValues.data();
+    std::fill_n(columnsSet, gridSize, 0);
+    std::fill_n(columnsDuplicated, gridSize, 0);
+
+    std::array<PossibilitiesBitSet, MaxGridSize> bandSet;
+    std::array<PossibilitiesBitSet, MaxGridSize> bandDuplicated;
+    std::fill_n(bandSet.begin(), gridSize, 0);
+    std::fill_n(bandDuplicated.begin(), gridSize, 0);
+
+    auto const* cells = &grid.GetPossibilities(0);
+
+    for (int row = 0; row < gridSize; row++, cells += gridSize)
+    {
+        auto rowSetLanes = TLanes::Zero();
+        auto rowDuplicatedLanes = TLanes::Zero();
+
+        int col = 0;
+
+        for (; col + TLanes::Width <= gridSize; col += TLanes::Width)
+        {
+            const auto values = TLanes::SetValues(TLanes::Load(cells + col));
+
+            AddToAccumulators<TLanes>(columnsSet + col, columnsDuplicated + col, values);
+            AddToAccumulators<TLanes>(&bandSet[col], &bandDuplicated[col], values);
+            Add<TLanes>(rowSetLanes, rowDuplicatedLanes, values);
+        }
+
+        std::array<PossibilitiesBitSet, TLanes::Width> rowSet;
+        std::array<PossibilitiesBitSet, TLanes::Width> rowDuplicated;
+        TLanes::Store(rowSet.data(), rowSetLanes);
+        TLanes::Store(rowDuplicated.data(), rowDuplicatedLanes);
+
+        PossibilitiesBitSet set {};
+        PossibilitiesBitSet duplicated {};
+
+        for (int lane = 0; lane < TLanes::Width; lane++)
+            Merge(set, duplicated, rowSet[lane], rowDuplicated[lane]);
+
+        for (; col < gridSize; col++)
+        {
+            const auto values = ScalarLanes::SetValues(cells[col].GetBitSet());
+
+            AddToAccumulators<ScalarLanes>(columnsSet + col, columnsDuplicated + col, values);
+            AddToAccumulators<ScalarLanes>(&bandSet[col], &bandDuplicated[col], values);
+            Add<ScalarLanes>(set, duplicated, values);
+        }
+
+        fold.m_SetValues[gridSize + row] = set;
+        fold.m_DuplicatedValues[gridSize + row] = duplicated;
+
+        if ((row + 1) % blockRows != 0)
+            continue;
+
+        const auto firstBlockUnit = 2 * gridSize + (row / blockRows) * blocksPerBand;
+
+        for (int block = 0; block < blocksPerBand; block++)
+        {
+            PossibilitiesBitSet blockSet {};
+            PossibilitiesBitSet blockDuplicated {};
+
+            for (int blockCol = block * blockCols; blockCol < (block + 1) * blockCols; blockCol++)
+                Merge(blockSet, blockDuplicated, bandSet[blockCol], bandDuplicated[blockCol]);
+
+            fold.m_SetValues[firstBlockUnit + block] = blockSet;
+            fold.m_DuplicatedValues[firstBlockUnit + block] = blockDuplicated;
+        }
+
+        std::fill_n(bandSet.begin(), gridSize, 0);
+        std::fill_n(bandDuplicated.begin(), gridSize, 0);
+    }
+
+    return fold;
+}
+
+} // anonymous namespace
+
+UnitsFold FoldSetValues(Grid const& grid)
+{
+    return FoldSetValuesWith<detail::VectorLanes>(grid);
+}
+
+namespace detail
+{
+
+UnitsFold FoldSetValuesScalar(Grid const& grid)
+{
+    return FoldSetValuesWith<ScalarLanes>(grid);
+}
+
+} // namespace detail
+
+} // namespace sudoku
@@ -0,0 +1,31 @@
+#pragma once
+
+#include <array>
+
+#include "Constants.hpp"
+#include "GridUnits.hpp"
+#include "Possibilities.hpp"
+
+namespace sudoku
+{
+
+class Grid;
+
+// For each unit, numbered as in GridUnits, the values of the cells set in it,
+// and the values set in at least two of its cells. Only the first GetUnitsCount() entries are used.
+struct UnitsFold
+{
+    std::array<PossibilitiesBitSet, GridUnits::UnitsPerCell * MaxGridSize> m_SetValues;
+    std::array<PossibilitiesBitSet, GridUnits::UnitsPerCell * MaxGridSize> m_DuplicatedValues;
+};
+
+// Folds the rows of the grid a vector of cells at a time, with the widest instruction set available
+UnitsFold FoldSetValues(Grid const& grid);
+
+namespace detail
+{
+// One cell at a time, used where no vector instruction set is available
+UnitsFold FoldSetValuesScalar(Grid const& grid);
+} // namespace detail
+
+} // namespace sudoku
@@ -1,10 +1,15 @@
 #include <gtest/gtest.h>
 #include <gmock/gmock.h>
 
+#include <array>
+#include <set>
+#include <sstream>
+
 #include <boost/range/irange.hpp>
 
 #include "GridSolverFactory.hpp"
 #include "GridStatus.hpp"
+#include "GridText.hpp"
 #include "Grid.hpp"
 #include "utils/Utils.hpp"
 #include "GridStatusGetter.hpp"
@@ -25,93 +30,617 @@ public:
         m_GridStatusGetter()
     {}
 
+    static std::string GetName(SolverEngine engine)
+    {
+        switch (engine)
+        {
+        case SolverEngine::Cells : return "Cells engine";
+        case SolverEngine::DigitPlanes : return "DigitPlanes engine";
+        case SolverEngine::DancingLinks : return "DancingLinks engine";
+        }
+
+        return "Unknown engine";
+    }
+
+    // Every test is run with each of them
+    static constexpr std::array<SolverEngine, 3> SolverEngines {SolverEngine::Cells, SolverEngine::DigitPlanes, SolverEngine::DancingLinks};
+
+    // Solves the grids packed in a buffer, then checks that the grids solved are correct and keep their values
+    void SolveBatchAndCheck(BatchGridSolver const& batchGridSolver, std::vector<Grid> const& grids)
+    {
+        const auto gridSize = grids[0].GetGridSize();
+        const auto cellsCount = grids[0].GetCellsCount();
+
+        std::vector<std::uint8_t> values(grids.size() * cellsCount);
+
+        for (std::size_t i = 0; i < grids.size(); i++)
+            PackValues(grids[i], values.data() + i * cellsCount);
+
+        const auto solved = batchGridSolver.Solve(gridSize, values.data(), grids.size());
+
+        EXPECT_THAT(solved, Eq(std::vector<bool>(grids.size(), true)));
+
+        for (std::size_t i = 0; i < grids.size(); i++)
+        {
+            auto solution = UnpackValues(gridSize, values.data() + i * cellsCount);
+
+            EXPECT_THAT(m_GridStatusGetter.GetStatus(solution), Eq(GridStatus::SolvedCorrectly));
+
+            for (int index = 0; index < cellsCount; index++)
+            {
+                if (grids[i].GetPossibilities(index).OnlyOnePossibilityLeft())
+                {
+                    EXPECT_THAT(solution.GetPossibilities(index), Eq(grids[i].GetPossibilities(index)));
+                }
+            }
+        }
+    }
+
     GridStatusGetterImpl m_GridStatusGetter;
 };
 
 TEST_F(FTestGridSolver, Solve4x4)
 {
-    const int gridSize {4};
-    const int cellsKept {5};
+    for (auto engine : SolverEngines)
+    {
+        SCOPED_TRACE(GetName(engine));
+
+        const int gridSize {4};
+        const int cellsKept {5};
 
-    const auto positionsValues = CreatePositionsValues4x4();
+        const auto positionsValues = CreatePositionsValues4x4();
+
+        const int testExecutionCount = 100;
+        for([[gnu::unused]] int i : boost::irange(0, testExecutionCount))
+        {
+            auto gridSolver = GridSolverFactory::Make(engine);
 
-    const int testExecutionCount = 100;
-    for([[gnu::unused]] int i : boost::irange(0, testExecutionCount))
+            auto grid = CreateGrid(gridSize, KeepRandomCells(positionsValues, cellsKept));
+
+            try
+            {
+                const auto solvedCorrectly = gridSolver->Solve(grid);
+                EXPECT_TRUE(solvedCorrectly);
+
+                auto gridStatus = m_GridStatusGetter.GetStatus(grid);
+                EXPECT_THAT(gridStatus, Eq(GridStatus::SolvedCorrectly));
+            }
+            catch(std::exception& e)
+            {
+                FAIL() << "Couldn't solve grid because: " << e.what();
+            }
+        }
+    }
+}
+
+TEST_F(FTestGridSolver, Solve6x6)
+{
+    for (auto engine : SolverEngines)
     {
-        auto gridSolver = GridSolverFactory::Make();
+        SCOPED_TRACE(GetName(engine));
 
-        auto grid = CreateGrid(gridSize, KeepRandomCells(positionsValues, cellsKept));
+        const int gridSize {6};
+        const int cellsKept {10};
 
-        try
+        const auto positionsValues = CreateSolvedPositionsValues(gridSize);
+
+        auto gridSolver = GridSolverFactory::Make(engine);
+
+        const int testExecutionCount = 100;
+        for([[gnu::unused]] int i : boost::irange(0, testExecutionCount))
         {
+            auto grid = CreateGrid(gridSize, KeepRandomCells(positionsValues, cellsKept));
+
             const auto solvedCorrectly = gridSolver->Solve(grid);
             EXPECT_TRUE(solvedCorrectly);
 
             auto gridStatus = m_GridStatusGetter.GetStatus(grid);
             EXPECT_THAT(gridStatus, Eq(GridStatus::SolvedCorrectly));
         }
-        catch(std::exception& e)
+    }
+}
+
+TEST_F(FTestGridSolver, Solve9x9)
+{
+    for (auto engine : SolverEngines)
+    {
+        SCOPED_TRACE(GetName(engine));
+
+        const int gridSize {9};
+        const int cellsKept {35};
+
+        const auto positionsValues = CreatePositionsValues9x9();
+
+        const int testExecutionCount = 1000;
+        for([[gnu::unused]] int i : boost::irange(0, testExecutionCount))
         {
-            FAIL() << "Couldn't solve grid because: " << e.what();
+            auto gridSolver = GridSolverFactory::Make(engine);
+
+            auto grid = CreateGrid(gridSize, KeepRandomCells(positionsValues, cellsKept));
+
+            try
+            {
+                const auto solvedCorrectly = gridSolver->Solve(grid);
+                EXPECT_TRUE(solvedCorrectly);
+
+                auto gridStatus = m_GridStatusGetter.GetStatus(grid);
+                EXPECT_THAT(gridStatus, Eq(GridStatus::SolvedCorrectly));
+            }
+            catch(std::exception& e)
+            {
+                FAIL() << "Couldn't solve grid because: " << e.what();
+            }
         }
     }
 }
 
-TEST_F(FTestGridSolver, Solve9x9)
+TEST_F(FTestGridSolver, Solve9x9WithSolverSpecialisedForGridSize)
 {
-    const int gridSize {9};
-    const int cellsKept {35};
+    for (auto engine : SolverEngines)
+    {
+        SCOPED_TRACE(GetName(engine));
 
-    const auto positionsValues = CreatePositionsValues9x9();
+        const int gridSize {9};
+        const int cellsKept {25};
+
+        const auto positionsValues = CreatePositionsValues9x9();
+
+        auto gridSolver = GridSolverFactory::Make<gridSize>(engine);
+
+        const int testExecutionCount = 100;
+        for([[gnu::unused]] int i : boost::irange(0, testExecutionCount))
+        {
+            auto grid = CreateGrid(gridSize, KeepRandomCells(positionsValues, cellsKept));
+
+            const auto solvedCorrectly = gridSolver->Solve(grid);
+            EXPECT_TRUE(solvedCorrectly);
+
+            auto gridStatus = m_GridStatusGetter.GetStatus(grid);
+            EXPECT_THAT(gridStatus, Eq(GridStatus::SolvedCorrectly));
+        }
+    }
+}
 
-    const int testExecutionCount = 1000;
-    for([[gnu::unused]] int i : boost::irange(0, testExecutionCount))
+TEST_F(FTestGridSolver, SolveHard9x9)
+{
+    for (auto engine : SolverEngines)
     {
-        auto gridSolver = GridSolverFactory::Make();
+        SCOPED_TRACE(GetName(engine));
 
-        auto grid = CreateGrid(gridSize, KeepRandomCells(positionsValues, cellsKept));
+        const int gridSize {9};
 
-        try
+        for (auto const& positionsValues : CreateHardGrids9x9())
         {
+            auto gridSolver = GridSolverFactory::Make(engine);
+
+            auto grid = CreateGrid(gridSize, positionsValues);
+
             const auto solvedCorrectly = gridSolver->Solve(grid);
             EXPECT_TRUE(solvedCorrectly);
 
             auto gridStatus = m_GridStatusGetter.GetStatus(grid);
             EXPECT_THAT(gridStatus, Eq(GridStatus::SolvedCorrectly));
+
+            for (auto const& [position, value] : positionsValues)
+                EXPECT_THAT(grid.GetCell(position).GetValue(), Eq(value));
         }
-        catch(std::exception& e)
+    }
+}
+
+TEST_F(FTestGridSolver, SolveHard9x9WithDeductions)
+{
+    const std::vector<Deductions> deductionsList
+        {
+            {{Deduction::LockedCandidates}},
+            {{Deduction::NakedSubsets}},
+            {{Deduction::HiddenSubsets}},
+            {{Deduction::HiddenSubsets, Deduction::NakedSubsets, Deduction::LockedCandidates}}
+        };
+
+    for (auto const& deductions : deductionsList)
+    {
+        const int gridSize {9};
+
+        for (auto const& positionsValues : CreateHardGrids9x9())
         {
-            FAIL() << "Couldn't solve grid because: " << e.what();
+            auto gridSolver = GridSolverFactory::Make(SolverEngine::Cells, deductions);
+
+            auto grid = CreateGrid(gridSize, positionsValues);
+
+            const auto solvedCorrectly = gridSolver->Solve(grid);
+            EXPECT_TRUE(solvedCorrectly);
+
+            auto gridStatus = m_GridStatusGetter.GetStatus(grid);
+            EXPECT_THAT(gridStatus, Eq(GridStatus::SolvedCorrectly));
+
+            for (auto const& [position, value] : positionsValues)
+                EXPECT_THAT(grid.GetCell(position).GetValue(), Eq(value));
         }
     }
 }
 
-TEST_F(FTestGridSolver, SolveWrong9x9)
+TEST_F(FTestGridSolver, SolveWithEachBranching)
+{
+    for (auto branching : {Branching::LeastConstrainingValue, Branching::MostConstrainedUnits, Branching::UnitCells})
+    {
+        SCOPED_TRACE(static_cast<int>(branching));
+
+        auto gridSolver = GridSolverFactory::Make(SolverEngine::Cells, {}, branching);
+
+        for (auto const& positionsValues : CreateHardGrids9x9())
+        {
+            auto grid = CreateGrid(9, positionsValues);
+
+            EXPECT_TRUE(gridSolver->Solve(grid));
+            EXPECT_THAT(m_GridStatusGetter.GetStatus(grid), Eq(GridStatus::SolvedCorrectly));
+
+            for (auto const& [position, value] : positionsValues)
+                EXPECT_THAT(grid.GetCell(position).GetValue(), Eq(value));
+        }
+
+        const auto positionsValues = CreateSolvedPositionsValues(16);
+
+        for([[gnu::unused]] int i : boost::irange(0, 5))
+        {
+            auto grid = CreateGrid(16, KeepRandomCells(positionsValues, 140));
+
+            EXPECT_TRUE(gridSolver->Solve(grid));
+            EXPECT_THAT(m_GridStatusGetter.GetStatus(grid), Eq(GridStatus::SolvedCorrectly));
+        }
+
+        // Any other value in a cell of a grid with a single solution leaves nothing to find, once all the hypotheses are tried
+        const auto hardGrid = CreateGrid(9, CreateHardGrids9x9().front());
+        auto solvedGrid = hardGrid;
+        gridSolver->Solve(solvedGrid);
+
+        const Position position {0, 1};
+        const auto solutionValue = *solvedGrid.GetCell(position).GetValue();
+
+        for (Value value = 1; value <= 9; value++)
+        {
+            if (value == solutionValue)
+                continue;
+
+            auto wrongGrid = hardGrid;
+            wrongGrid.GetCell(position).SetValue(value);
+
+            EXPECT_FALSE(gridSolver->Solve(wrongGrid));
+        }
+    }
+}
+
+TEST_F(FTestGridSolver, SolveInParallel)
+{
+    ParallelSearch parallelSearch;
+    parallelSearch.m_ThreadsCount = 4;
+
+    auto gridSolver = GridSolverFactory::MakeParallel(parallelSearch);
+
+    for (auto const& positionsValues : CreateHardGrids9x9())
+    {
+        auto grid = CreateGrid(9, positionsValues);
+
+        EXPECT_TRUE(gridSolver->Solve(grid));
+        EXPECT_THAT(m_GridStatusGetter.GetStatus(grid), Eq(GridStatus::SolvedCorrectly));
+
+        for (auto const& [position, value] : positionsValues)
+            EXPECT_THAT(grid.GetCell(position).GetValue(), Eq(value));
+    }
+
+    const auto positionsValues = CreateSolvedPositionsValues(16);
+
+    for([[gnu::unused]] int i : boost::irange(0, 5))
+    {
+        auto grid = CreateGrid(16, KeepRandomCells(positionsValues, 120));
+
+        EXPECT_TRUE(gridSolver->Solve(grid));
+        EXPECT_THAT(m_GridStatusGetter.GetStatus(grid), Eq(GridStatus::SolvedCorrectly));
+    }
+
+    // Every task gives up without a solution
+    auto wrongGrid = CreateGrid(9, CreateHardGrids9x9().front());
+    auto solvedGrid = wrongGrid;
+    gridSolver->Solve(solvedGrid);
+
+    const Position position {0, 1};
+    wrongGrid.GetCell(position).SetValue(*solvedGrid.GetCell(position).GetValue() % 9 + 1);
+
+    EXPECT_FALSE(gridSolver->Solve(wrongGrid));
+}
+
+TEST_F(FTestGridSolver, Solve16x16)
+{
+    for (auto engine : SolverEngines)
+    {
+        SCOPED_TRACE(GetName(engine));
+
+        const int gridSize {16};
+        const int cellsKept {140};
+
+        const auto positionsValues = CreateSolvedPositionsValues(gridSize);
+
+        auto gridSolver = GridSolverFactory::Make(engine);
+
+        const int testExecutionCount = 20;
+        for([[gnu::unused]] int i : boost::irange(0, testExecutionCount))
+        {
+            auto grid = CreateGrid(gridSize, KeepRandomCells(positionsValues, cellsKept));
+
+            const auto solvedCorrectly = gridSolver->Solve(grid);
+            EXPECT_TRUE(solvedCorrectly);
+
+            auto gridStatus = m_GridStatusGetter.GetStatus(grid);
+            EXPECT_THAT(gridStatus, Eq(GridStatus::SolvedCorrectly));
+        }
+    }
+}
+
+TEST_F(FTestGridSolver, Solve25x25)
+{
+    for (auto engine : SolverEngines)
+    {
+        SCOPED_TRACE(GetName(engine));
+
+        const int gridSize {25};
+        const int cellsKept {380};
+
+        const auto positionsValues = CreateSolvedPositionsValues(gridSize);
+
+        auto gridSolver = GridSolverFactory::Make(engine);
+
+        const int testExecutionCount = 10;
+        for([[gnu::unused]] int i : boost::irange(0, testExecutionCount))
+        {
+            auto grid = CreateGrid(gridSize, KeepRandomCells(positionsValues, cellsKept));
+
+            const auto solvedCorrectly = gridSolver->Solve(grid);
+            EXPECT_TRUE(solvedCorrectly);
+
+            auto gridStatus = m_GridStatusGetter.GetStatus(grid);
+            EXPECT_THAT(gridStatus, Eq(GridStatus::SolvedCorrectly));
+        }
+    }
+}
+
+TEST_F(FTestGridSolver, SolveBatch9x9)
 {
     const int gridSize {9};
     const int cellsKept {35};
 
     const auto positionsValues = CreatePositionsValues9x9();
 
-    const int testExecutionCount = 50;
-    for([[gnu::unused]] int i : boost::irange(0, testExecutionCount))
+    std::vector<Grid> grids;
+
+    for([[gnu::unused]] int i : boost::irange(0, 100))
+        grids.push_back(CreateGrid(gridSize, KeepRandomCells(positionsValues, cellsKept)));
+
+    SolveBatchAndCheck(*GridSolverFactory::MakeBatch(), grids);
+}
+
+TEST_F(FTestGridSolver, SolveParallelBatch)
+{
+    const auto positionsValues = CreatePositionsValues9x9();
+    const auto hardGrids = CreateHardGrids9x9();
+
+    // Hard grids among easy ones, so that some tasks are much longer than the others
+    std::vector<Grid> grids;
+
+    for (int i : boost::irange(0, 200))
     {
-        auto gridSolver = GridSolverFactory::Make();
+        if (i % 20 == 0)
+            grids.push_back(CreateGrid(9, hardGrids[i / 20 % hardGrids.size()]));
+        else
+            grids.push_back(CreateGrid(9, KeepRandomCells(positionsValues, 30)));
+    }
+
+    SolveBatchAndCheck(*GridSolverFactory::MakeParallelBatch(4), grids);
+}
 
-        auto gridRandCells = KeepRandomCells(positionsValues, cellsKept);
-        gridRandCells.front().second = ((gridRandCells.front().second + 1) % gridSize) + 1;
-        gridRandCells.back().second = ((gridRandCells.front().second + 3) % gridSize) + 1;
-        auto grid = CreateGrid(gridSize, gridRandCells);
+TEST_F(FTestGridSolver, SolveStream)
+{
+    const auto hardGrids = CreateHardGrids9x9();
 
-        try
+    std::stringstream input;
+
+    for (auto const& positionsValues : hardGrids)
+        input << FormatGrid(CreateGrid(9, positionsValues)) << '\n';
+
+    std::stringstream output;
+    const auto report = GridSolverFactory::MakeStream(4)->Solve(input, output);
+
+    EXPECT_THAT(report.m_GridsCount, Eq(hardGrids.size()));
+    EXPECT_THAT(report.m_UnsolvedGridsCount, Eq(0u));
+
+    for (auto const& positionsValues : hardGrids)
+    {
+        std::string line;
+        std::getline(output, line);
+
+        auto grid = ParseGrid(line);
+
+        EXPECT_THAT(m_GridStatusGetter.GetStatus(grid), Eq(GridStatus::SolvedCorrectly));
+
+        for (auto const& [position, value] : positionsValues)
+            EXPECT_THAT(grid.GetCell(position).GetValue(), Eq(value));
+    }
+}
+
+TEST_F(FTestGridSolver, CountSolutions)
+{
+    auto solutionsFinder = GridSolverFactory::MakeSolutionsFinder();
+
+    for (auto const& positionsValues : CreateHardGrids9x9())
+    {
+        const auto solutionsCount = solutionsFinder->CountSolutions(CreateGrid(9, positionsValues), 2);
+        EXPECT_THAT(solutionsCount, Eq(1));
+    }
+
+    // The 288 grids of size 4, a quarter of them with a given value in a given cell
+    const auto grid4x4 = CreateGrid(4, {{Position {0, 0}, 1}});
+    EXPECT_THAT(solutionsFinder->CountSolutions(grid4x4, 1000), Eq(72));
+    EXPECT_THAT(solutionsFinder->CountSolutions(grid4x4, 2), Eq(2));
+
+    const auto wrongGrid = CreateGrid(4, {{Position {0, 0}, 1}, {Position {0, 1}, 1}});
+    EXPECT_THAT(solutionsFinder->CountSolutions(wrongGrid, 2), Eq(0));
+}
+
+TEST_F(FTestGridSolver, EnumerateSolutions)
+{
+    ParallelSearch parallelSearch;
+    parallelSearch.m_ThreadsCount = 4;
+    parallelSearch.m_SplitMinUnsetCells = 0;
+
+    auto solutionsFinder = GridSolverFactory::MakeSolutionsFinder();
+    auto parallelSolutionsFinder = GridSolverFactory::MakeParallelSolutionsFinder(parallelSearch);
+
+    // All the solutions are distinct and valid
+    std::set<std::string> solutions;
+
+    auto visitor = [&](Grid const& solution)
         {
-            const auto solvedCorrectly = gridSolver->Solve(grid);
+            auto solutionGrid = solution;
+            EXPECT_THAT(m_GridStatusGetter.GetStatus(solutionGrid), Eq(GridStatus::SolvedCorrectly));
+            solutions.insert(FormatGrid(solution));
+            return true;
+        };
+
+    const auto grid = CreateGrid(4, {{Position {0, 0}, 1}});
+
+    EXPECT_THAT(solutionsFinder->EnumerateSolutions(grid, visitor), Eq(72));
+    EXPECT_THAT(solutions.size(), Eq(72u));
+
+    solutions.clear();
+    EXPECT_THAT(parallelSolutionsFinder->EnumerateSolutions(grid, visitor), Eq(72));
+    EXPECT_THAT(solutions.size(), Eq(72u));
 
-            EXPECT_FALSE(solvedCorrectly);
+    EXPECT_THAT(parallelSolutionsFinder->EnumerateSolutions(grid, [](Grid const&){ return false; }), Eq(1));
+    EXPECT_THAT(parallelSolutionsFinder->CountSolutions(grid, 10), Eq(10));
+
+    for (auto const& positionsValues : CreateHardGrids9x9())
+        EXPECT_THAT(parallelSolutionsFinder->CountSolutions(CreateGrid(9, positionsValues), 2), Eq(1));
+}
+
+TEST_F(FTestGridSolver, SolveEmptyGrids)
+{
+    ParallelSearch parallelSearch;
+    parallelSearch.m_ThreadsCount = 4;
+
+    for (const int gridSize : {4, 9, 16})
+    {
+        SCOPED_TRACE("Grid size " + std::to_string(gridSize));
+
+        std::vector<std::unique_ptr<GridSolver>> gridSolvers;
+
+        for (auto engine : SolverEngines)
+            gridSolvers.push_back(GridSolverFactory::Make(engine));
+
+        gridSolvers.push_back(GridSolverFactory::MakeParallel(parallelSearch));
+
+        for (auto const& gridSolver : gridSolvers)
+        {
+            Grid grid {gridSize};
+
+            EXPECT_TRUE(gridSolver->Solve(grid));
+            EXPECT_THAT(m_GridStatusGetter.GetStatus(grid), Eq(GridStatus::SolvedCorrectly));
         }
-        catch(std::exception& e)
+
+        SolveBatchAndCheck(*GridSolverFactory::MakeBatch(), std::vector<Grid>(4, Grid {gridSize}));
+    }
+}
+
+TEST_F(FTestGridSolver, FindSolutionsOfEmptyGrids)
+{
+    ParallelSearch parallelSearch;
+    parallelSearch.m_ThreadsCount = 4;
+    parallelSearch.m_SplitMinUnsetCells = 0;
+
+    std::vector<std::unique_ptr<SolutionsFinder>> solutionsFinders;
+    solutionsFinders.push_back(GridSolverFactory::MakeSolutionsFinder(SolverEngine::Cells));
+    solutionsFinders.push_back(GridSolverFactory::MakeSolutionsFinder(SolverEngine::DigitPlanes));
+    solutionsFinders.push_back(GridSolverFactory::MakeParallelSolutionsFinder(parallelSearch));
+
+    for (auto const& solutionsFinder : solutionsFinders)
+    {
+        for (const int gridSize : {4, 9, 16})
+            EXPECT_THAT(solutionsFinder->CountSolutions(Grid {gridSize}, 2), Eq(2));
+
+        std::set<std::string> solutions;
+
+        auto visitor = [&](Grid const& solution)
+            {
+                auto solutionGrid = solution;
+                EXPECT_THAT(m_GridStatusGetter.GetStatus(solutionGrid), Eq(GridStatus::SolvedCorrectly));
+                solutions.insert(FormatGrid(solution));
+                return true;
+            };
+
+        // Every grid of size 4
+        EXPECT_THAT(solutionsFinder->EnumerateSolutions(Grid {4}, visitor), Eq(288));
+        EXPECT_THAT(solutions.size(), Eq(288u));
+
+        EXPECT_THAT(solutionsFinder->EnumerateSolutions(Grid {9}, [](Grid const&){ return false; }), Eq(1));
+    }
+}
+
+TEST_F(FTestGridSolver, GenerateGrids)
+{
+    auto solutionsFinder = GridSolverFactory::MakeSolutionsFinder();
+
+    for (const int gridSize : {4, 6, 9})
+    {
+        PuzzleGeneration puzzleGeneration;
+        puzzleGeneration.m_GridSize = gridSize;
+        puzzleGeneration.m_CluesCount = gridSize * gridSize / 2;
+        puzzleGeneration.m_Symmetry = Symmetry::Central;
+
+        const auto grids = GridSolverFactory::MakeGenerator(puzzleGeneration, 2)->Generate(20, 0);
+
+        EXPECT_THAT(grids.size(), Eq(20u));
+
+        for (auto const& grid : grids)
+        {
+            EXPECT_THAT(grid.GetGridSize(), Eq(gridSize));
+            EXPECT_THAT(solutionsFinder->CountSolutions(grid, 2), Eq(1));
+        }
+    }
+}
+
+TEST_F(FTestGridSolver, SolveWrong9x9)
+{
+    for (auto engine : SolverEngines)
+    {
+        SCOPED_TRACE(GetName(engine));
+
+        const int gridSize {9};
+        const int cellsKept {35};
+
+        const auto positionsValues = CreatePositionsValues9x9();
+
+        const int testExecutionCount = 50;
+        for([[gnu::unused]] int i : boost::irange(0, testExecutionCount))
         {
-            SUCCEED() << "Couldn't solve grid because: " << e.what();
+            auto gridSolver = GridSolverFactory::Make(engine);
+
+            auto gridRandCells = KeepRandomCells(positionsValues, cellsKept);
+
+            // Same value twice on a row, changing random values could still leave a solvable grid
+            const auto [position, value] = gridRandCells.front();
+            const Position duplicatePosition {position.m_Row, (position.m_Col + 1) % gridSize};
+            boost::range::remove_erase_if(gridRandCells, [&](auto const& positionValue){ return positionValue.first == duplicatePosition; });
+            gridRandCells.push_back({duplicatePosition, value});
+
+            auto grid = CreateGrid(gridSize, gridRandCells);
+
+            try
+            {
+                const auto solvedCorrectly = gridSolver->Solve(grid);
+
+                EXPECT_FALSE(solvedCorrectly);
+            }
+            catch(std::exception& e)
+            {
+                SUCCEED() << "Couldn't solve grid because: " << e.what();
+            }
         }
     }
 }
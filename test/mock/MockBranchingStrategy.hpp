@@ -0,0 +1,19 @@
+#pragma once
+
+#include "BranchingStrategy.hpp"
+#include <gmock/gmock.h>
+
+namespace sudoku
+{
+namespace test
+{
+
+class MockBranchingStrategy : public BranchingStrategy
+{
+public:
+    MOCK_CONST_METHOD1(SelectBranch, Branch(Grid const& grid));
+    MOCK_CONST_METHOD2(SelectHypothesis, Hypothesis(Grid const& grid, Branch const& branch));
+};
+
+} /* namespace test */
+} /* namespace sudoku */
@@ -11,7 +11,7 @@ namespace test
 class MockGridPossibilitiesUpdater : public GridPossibilitiesUpdater
 {
 public:
-    MOCK_METHOD2(UpdateGrid, void(FoundPositions& foundPositions, Grid& grid));
+    MOCK_METHOD2(UpdateGrid, bool(FoundPositions& foundPositions, Grid& grid));
 };
 
 } /* namespace test */
@@ -0,0 +1,18 @@
+#pragma once
+
+#include "PatternPossibilitiesRemover.hpp"
+#include <gmock/gmock.h>
+
+namespace sudoku
+{
+namespace test
+{
+
+class MockPatternPossibilitiesRemover : public PatternPossibilitiesRemover
+{
+public:
+    MOCK_CONST_METHOD3(RemovePossibilities, bool(Grid& grid, FoundPositions& foundPositions, bool& possibilitiesRemoved));
+};
+
+} /* namespace test */
+} /* namespace sudoku */
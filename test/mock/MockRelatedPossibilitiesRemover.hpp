@@ -11,7 +11,7 @@ namespace test
 class MockRelatedPossibilitiesRemover : public RelatedPossibilitiesRemover
 {
 public:
-    MOCK_CONST_METHOD3(UpdateRelatedPossibilities, void(Position const& newFoundPosition, Grid& grid, FoundPositions& foundPositions));
+    MOCK_CONST_METHOD3(UpdateRelatedPossibilities, bool(Position const& newFoundPosition, Grid& grid, FoundPositions& foundPositions));
 };
 
 } /* namespace test */
@@ -0,0 +1,192 @@
+#include "BatchGridSolver.hpp"
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include "Grid.hpp"
+#include "GridStatus.hpp"
+#include "GridStatusGetter.hpp"
+#include "utils/Utils.hpp"
+
+#include "mock/MockGridSolverWithHypothesis.hpp"
+
+using testing::_;
+using testing::Eq;
+using testing::Invoke;
+using testing::Return;
+using testing::StrictMock;
+
+namespace sudoku
+{
+namespace test
+{
+
+class TestBatchGridSolver : public ::testing::Test
+{
+public:
+    TestBatchGridSolver()
+    {}
+
+    std::unique_ptr<BatchGridSolver> MakeBatchGridSolver()
+    {
+        return std::make_unique<BatchGridSolverImpl<MockGridSolver>>(std::move(m_GridSolver));
+    }
+
+    // Every few cells of a solved grid are left blank, so that single possibilities are enough to solve it
+    Grid CreateGridSolvedByPropagation(int gridSize, int blankCellsInterval)
+    {
+        auto positionsValues = CreateSolvedPositionsValues(gridSize);
+
+        for (int i = 0; i < static_cast<int>(positionsValues.size()); i += blankCellsInterval)
+            positionsValues.erase(positionsValues.begin() + i);
+
+        return CreateGrid(gridSize, positionsValues);
+    }
+
+    static std::vector<std::uint8_t> Pack(std::vector<Grid> const& grids)
+    {
+        const auto cellsCount = grids[0].GetCellsCount();
+        std::vector<std::uint8_t> values(grids.size() * cellsCount);
+
+        for (std::size_t i = 0; i < grids.size(); i++)
+            PackValues(grids[i], values.data() + i * cellsCount);
+
+        return values;
+    }
+
+    std::unique_ptr<MockGridSolver> m_GridSolver = std::make_unique<StrictMock<MockGridSolver>>();
+
+    GridStatusGetterImpl m_GridStatusGetter;
+};
+
+TEST_F(TestBatchGridSolver, GridsSolvedByPropagationNotHandedToGridSolver)
+{
+    const int gridsCount {detail::BatchWidth + 5};
+
+    std::vector<Grid> grids;
+
+    for (int i = 0; i < gridsCount; i++)
+        grids.push_back(CreateGridSolvedByPropagation(9, 3 + i % 4));
+
+    auto values = Pack(grids);
+
+    const auto solved = MakeBatchGridSolver()->Solve(9, values.data(), gridsCount);
+
+    EXPECT_THAT(solved, Eq(std::vector<bool>(gridsCount, true)));
+
+    for (int i = 0; i < gridsCount; i++)
+    {
+        auto grid = UnpackValues(9, values.data() + i * 81);
+        EXPECT_THAT(m_GridStatusGetter.GetStatus(grid), Eq(GridStatus::SolvedCorrectly));
+    }
+}
+
+TEST_F(TestBatchGridSolver, GridsOfEachSize)
+{
+    auto batchGridSolver = MakeBatchGridSolver();
+
+    // The lanes kept from a larger grid size are reused for the smaller ones
+    for (const int gridSize : {16, 4, 9})
+    {
+        std::vector<Grid> grids {CreateGridSolvedByPropagation(gridSize, 4), CreateGridSolvedByPropagation(gridSize, 5)};
+        auto values = Pack(grids);
+
+        const auto solved = batchGridSolver->Solve(gridSize, values.data(), grids.size());
+
+        EXPECT_THAT(solved, Eq(std::vector<bool>(grids.size(), true)));
+
+        for (std::size_t i = 0; i < grids.size(); i++)
+        {
+            auto grid = UnpackValues(gridSize, values.data() + i * gridSize * gridSize);
+            EXPECT_THAT(m_GridStatusGetter.GetStatus(grid), Eq(GridStatus::SolvedCorrectly));
+        }
+    }
+}
+
+TEST_F(TestBatchGridSolver, GridNeedingHypothesisHandedToGridSolver)
+{
+    std::vector<Grid> grids {CreateGridSolvedByPropagation(9, 3), Grid {9}, Grid {9}};
+    auto values = Pack(grids);
+
+    const auto solution = CreateGrid(9, CreateSolvedPositionsValues(9));
+
+    EXPECT_CALL(*m_GridSolver, Solve(_))
+            .WillOnce(Invoke([&solution](Grid& grid){ grid = solution; return true; }))
+            .WillOnce(Return(false));
+
+    const auto solved = MakeBatchGridSolver()->Solve(9, values.data(), grids.size());
+
+    EXPECT_THAT(solved, Eq(std::vector<bool>{true, true, false}));
+    EXPECT_THAT(UnpackValues(9, values.data() + 81), Eq(solution));
+
+    // Left as it was
+    EXPECT_THAT(UnpackValues(9, values.data() + 2 * 81), Eq(grids[2]));
+}
+
+TEST_F(TestBatchGridSolver, WrongGridNotHandedToGridSolver)
+{
+    std::vector<Grid> grids {Grid {4}, CreateGridSolvedByPropagation(4, 3)};
+
+    grids[0].GetCell(Position{0, 0}).SetValue(2);
+    grids[0].GetCell(Position{0, 3}).SetValue(2);
+
+    auto values = Pack(grids);
+
+    const auto solved = MakeBatchGridSolver()->Solve(4, values.data(), grids.size());
+
+    EXPECT_THAT(solved, Eq(std::vector<bool>{false, true}));
+    EXPECT_THAT(UnpackValues(4, values.data()), Eq(grids[0]));
+}
+
+TEST_F(TestBatchGridSolver, ValueWithNoCellLeftInUnitIsWrong)
+{
+    // 1 can't be placed in the first row: its first blocks have a 1, its last cells have a 1 in their column or are set
+    auto grid = CreateGrid(9, {
+            {Position{1, 0}, 1},
+            {Position{2, 3}, 1},
+            {Position{3, 6}, 1},
+            {Position{6, 7}, 1},
+            {Position{0, 8}, 2}});
+
+    auto values = Pack({grid});
+
+    const auto solved = MakeBatchGridSolver()->Solve(9, values.data(), 1);
+
+    EXPECT_THAT(solved, Eq(std::vector<bool>{false}));
+}
+
+TEST_F(TestBatchGridSolver, ValueAboveGridSizeIsWrong)
+{
+    std::vector<std::uint8_t> values(16, 0);
+    values[5] = 5;
+
+    const auto solved = MakeBatchGridSolver()->Solve(4, values.data(), 1);
+
+    EXPECT_THAT(solved, Eq(std::vector<bool>{false}));
+}
+
+TEST_F(TestBatchGridSolver, UnsupportedGridSizeThrows)
+{
+    std::vector<std::uint8_t> values(49, 0);
+
+    EXPECT_THROW(MakeBatchGridSolver()->Solve(7, values.data(), 1), std::runtime_error);
+}
+
+TEST_F(TestBatchGridSolver, ValuesPackedAndUnpacked)
+{
+    auto grid = CreateGrid(4, {{Position{0, 1}, 3}, {Position{3, 2}, 4}});
+    grid.GetCell(Position{1, 1}).RemovePossibility(2);
+
+    std::vector<std::uint8_t> values(16);
+    PackValues(grid, values.data());
+
+    EXPECT_THAT(values[1], Eq(3));
+    EXPECT_THAT(values[14], Eq(4));
+    EXPECT_THAT(values[5], Eq(0));
+
+    // Only the values set are kept
+    EXPECT_THAT(UnpackValues(4, values.data()), Eq(CreateGrid(4, {{Position{0, 1}, 3}, {Position{3, 2}, 4}})));
+}
+
+} /* namespace test */
+} /* namespace sudoku */
@@ -0,0 +1,111 @@
+#include "BoundedQueue.hpp"
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+using testing::Eq;
+
+namespace sudoku
+{
+namespace test
+{
+
+class TestBoundedQueue : public ::testing::Test
+{
+public:
+    TestBoundedQueue()
+    {}
+
+    BoundedQueue<int> m_Queue {2};
+};
+
+TEST_F(TestBoundedQueue, ItemsPoppedInPushOrder)
+{
+    m_Queue.Push(1);
+    m_Queue.Push(2);
+
+    EXPECT_THAT(m_Queue.Pop(), Eq(1));
+    EXPECT_THAT(m_Queue.Pop(), Eq(2));
+}
+
+TEST_F(TestBoundedQueue, ItemsLeftPoppedAfterClose)
+{
+    m_Queue.Push(1);
+    m_Queue.Close();
+
+    EXPECT_THAT(m_Queue.Pop(), Eq(1));
+    EXPECT_THAT(m_Queue.Pop(), Eq(std::nullopt));
+}
+
+TEST_F(TestBoundedQueue, PushWaitsForPopWhenFull)
+{
+    std::atomic<int> pushedCount {0};
+
+    std::thread producer([this, &pushedCount]
+        {
+            for (int i = 0; i < 3; i++)
+            {
+                m_Queue.Push(i);
+                pushedCount++;
+            }
+        });
+
+    while (pushedCount < 2)
+    {}
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    EXPECT_THAT(pushedCount.load(), Eq(2)) << "Third item pushed into a full queue";
+
+    EXPECT_THAT(m_Queue.Pop(), Eq(0));
+
+    producer.join();
+
+    EXPECT_THAT(pushedCount.load(), Eq(3));
+}
+
+TEST_F(TestBoundedQueue, CloseWakesUpWaitingConsumers)
+{
+    std::vector<std::thread> consumers;
+
+    for (int i = 0; i < 3; i++)
+        consumers.emplace_back([this]{ EXPECT_THAT(m_Queue.Pop(), Eq(std::nullopt)); });
+
+    m_Queue.Close();
+
+    for (auto& consumer : consumers)
+        consumer.join();
+}
+
+TEST_F(TestBoundedQueue, AllItemsPoppedOnceByConcurrentConsumers)
+{
+    const int itemsCount {10'000};
+
+    std::atomic<long> poppedSum {0};
+    std::vector<std::thread> consumers;
+
+    for (int i = 0; i < 4; i++)
+    {
+        consumers.emplace_back([this, &poppedSum]
+            {
+                while (auto item = m_Queue.Pop())
+                    poppedSum += *item;
+            });
+    }
+
+    for (int i = 1; i <= itemsCount; i++)
+        m_Queue.Push(i);
+
+    m_Queue.Close();
+
+    for (auto& consumer : consumers)
+        consumer.join();
+
+    EXPECT_THAT(poppedSum.load(), Eq(static_cast<long>(itemsCount) * (itemsCount + 1) / 2));
+}
+
+} /* namespace test */
+} /* namespace sudoku */
@@ -0,0 +1,117 @@
+#include "BranchingStrategy.hpp"
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include "Grid.hpp"
+#include "utils/Utils.hpp"
+
+using testing::Eq;
+
+namespace sudoku
+{
+namespace test
+{
+
+class TestBranchingStrategy : public ::testing::Test
+{
+public:
+    TestBranchingStrategy()
+    {}
+
+    void ExpectCellBranch(Branch const& branch, Position const& position)
+    {
+        EXPECT_THAT(branch.m_Kind, Eq(Branch::Kind::CellValues));
+        EXPECT_THAT(branch.m_Position, Eq(position));
+    }
+
+    FewestPossibilitiesBranchingImpl m_FewestPossibilities;
+    LeastConstrainingValueBranchingImpl m_LeastConstrainingValue;
+    MostConstrainedUnitsBranchingImpl m_MostConstrainedUnits;
+    UnitCellsBranchingImpl m_UnitCells;
+};
+
+TEST_F(TestBranchingStrategy, FirstCellWithFewestPossibilitiesAndItsHighestValue)
+{
+    Grid grid {4};
+
+    RemoveAllCellPossibilitiesBut(grid.GetCell(Position{2, 1}), {1, 3});
+    RemoveAllCellPossibilitiesBut(grid.GetCell(Position{1, 3}), {2, 4});
+
+    const auto branch = m_FewestPossibilities.SelectBranch(grid);
+    ExpectCellBranch(branch, Position{1, 3});
+
+    const auto hypothesis = m_FewestPossibilities.SelectHypothesis(grid, branch);
+    EXPECT_THAT(hypothesis.m_Position, Eq(Position{1, 3}));
+    EXPECT_THAT(hypothesis.m_Value, Eq(4));
+}
+
+TEST_F(TestBranchingStrategy, CompletedGridThrows)
+{
+    auto grid = Create4x4CorrectlySolvedGrid();
+
+    EXPECT_THROW(m_FewestPossibilities.SelectBranch(grid), std::runtime_error);
+}
+
+TEST_F(TestBranchingStrategy, ValuePossibleInFewestOtherCellsFirst)
+{
+    Grid grid {4};
+
+    RemoveAllCellPossibilitiesBut(grid.GetCell(Position{0, 0}), {1, 2});
+    grid.GetCell(Position{0, 2}).RemovePossibility(1);
+    grid.GetCell(Position{2, 0}).RemovePossibility(1);
+
+    const auto branch = m_LeastConstrainingValue.SelectBranch(grid);
+    ExpectCellBranch(branch, Position{0, 0});
+
+    EXPECT_THAT(m_LeastConstrainingValue.SelectHypothesis(grid, branch).m_Value, Eq(1));
+}
+
+TEST_F(TestBranchingStrategy, TiesBrokenByMostCellsLeftInUnits)
+{
+    Grid grid {4};
+
+    RemoveAllCellPossibilitiesBut(grid.GetCell(Position{0, 0}), {1, 2});
+    RemoveAllCellPossibilitiesBut(grid.GetCell(Position{3, 3}), {1, 2});
+    grid.GetCell(Position{0, 1}).SetValue(3);
+
+    ExpectCellBranch(m_MostConstrainedUnits.SelectBranch(grid), Position{3, 3});
+    ExpectCellBranch(m_FewestPossibilities.SelectBranch(grid), Position{0, 0});
+}
+
+TEST_F(TestBranchingStrategy, CellsOfUnitWhenFewerThanPossibilitiesOfAnyCell)
+{
+    Grid grid {9};
+
+    for (int col = 2; col < 9; col++)
+        grid.GetCell(Position{4, col}).RemovePossibility(5);
+
+    const auto branch = m_UnitCells.SelectBranch(grid);
+
+    EXPECT_THAT(branch.m_Kind, Eq(Branch::Kind::UnitCells));
+    EXPECT_THAT(branch.m_Unit, Eq(9 + 4));
+    EXPECT_THAT(branch.m_Value, Eq(5));
+    EXPECT_THAT(detail::CountHypothesesLeft(grid, branch), Eq(2));
+
+    const auto hypothesis = m_UnitCells.SelectHypothesis(grid, branch);
+    EXPECT_THAT(hypothesis.m_Position, Eq(Position{4, 0}));
+    EXPECT_THAT(hypothesis.m_Value, Eq(5));
+}
+
+TEST_F(TestBranchingStrategy, CellWhenNoUnitHasFewerCells)
+{
+    Grid grid {9};
+
+    for (int col = 2; col < 9; col++)
+        grid.GetCell(Position{4, col}).RemovePossibility(5);
+
+    RemoveAllCellPossibilitiesBut(grid.GetCell(Position{7, 7}), {3, 6});
+
+    const auto branch = m_UnitCells.SelectBranch(grid);
+
+    ExpectCellBranch(branch, Position{7, 7});
+    EXPECT_THAT(detail::CountHypothesesLeft(grid, branch), Eq(2));
+}
+
+} /* namespace test */
+} /* namespace sudoku */
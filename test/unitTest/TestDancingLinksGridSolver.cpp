@@ -0,0 +1,161 @@
+#include "DancingLinksGridSolver.hpp"
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include "Grid.hpp"
+#include "GridStatus.hpp"
+#include "GridStatusGetter.hpp"
+#include "utils/Utils.hpp"
+
+using testing::AnyOf;
+using testing::Eq;
+using testing::Ne;
+
+namespace sudoku
+{
+namespace test
+{
+
+class TestDancingLinksGridSolver : public ::testing::Test
+{
+public:
+    TestDancingLinksGridSolver()
+    {}
+
+    DancingLinksGridSolverImpl<4> m_GridSolver4x4;
+    DancingLinksGridSolverImpl<9> m_GridSolver9x9;
+
+    GridStatusGetterImpl m_GridStatusGetter;
+};
+
+TEST_F(TestDancingLinksGridSolver, SolveGridWithFewCellsSet)
+{
+    auto grid = CreateGrid(9, KeepRandomCells(CreatePositionsValues9x9(), 17));
+
+    EXPECT_TRUE(m_GridSolver9x9.Solve(grid));
+    EXPECT_THAT(m_GridStatusGetter.GetStatus(grid), Eq(GridStatus::SolvedCorrectly));
+}
+
+TEST_F(TestDancingLinksGridSolver, SolveGridNeedingHypotheses)
+{
+    Grid grid {9};
+
+    EXPECT_TRUE(m_GridSolver9x9.Solve(grid));
+    EXPECT_THAT(m_GridStatusGetter.GetStatus(grid), Eq(GridStatus::SolvedCorrectly));
+}
+
+TEST_F(TestDancingLinksGridSolver, CellsSetInGridKept)
+{
+    const auto positionsValues = CreatePositionsValues9x9();
+
+    auto grid = CreateGrid(9, KeepRandomCells(positionsValues, 20));
+    const auto gridBefore = grid;
+
+    EXPECT_TRUE(m_GridSolver9x9.Solve(grid));
+
+    for (int index = 0; index < grid.GetCellsCount(); index++)
+    {
+        if (gridBefore.GetPossibilities(index).OnlyOnePossibilityLeft())
+        {
+            EXPECT_THAT(grid.GetPossibilities(index), Eq(gridBefore.GetPossibilities(index)));
+        }
+    }
+}
+
+TEST_F(TestDancingLinksGridSolver, WrongGridLeftUnchanged)
+{
+    Grid grid {4};
+
+    grid.GetCell(Position{0, 0}).SetValue(2);
+    grid.GetCell(Position{3, 0}).SetValue(2);
+
+    const auto gridBefore = grid;
+
+    EXPECT_FALSE(m_GridSolver4x4.Solve(grid));
+
+    for (int index = 0; index < grid.GetCellsCount(); index++)
+        EXPECT_THAT(grid.GetPossibilities(index), Eq(gridBefore.GetPossibilities(index)));
+}
+
+TEST_F(TestDancingLinksGridSolver, CellWithNoPossibilityLeftIsWrong)
+{
+    Grid grid {4};
+
+    for (Value value = 1; value <= 4; value++)
+        grid.GetCell(Position{1, 2}).RemovePossibility(value);
+
+    EXPECT_FALSE(m_GridSolver4x4.Solve(grid));
+}
+
+TEST_F(TestDancingLinksGridSolver, ValueWithNoCellLeftInUnitIsWrong)
+{
+    Grid grid {4};
+
+    for (int col = 0; col < 4; col++)
+        grid.GetCell(Position{2, col}).RemovePossibility(3);
+
+    EXPECT_FALSE(m_GridSolver4x4.Solve(grid));
+}
+
+TEST_F(TestDancingLinksGridSolver, PossibilitiesRemovedFromCellsNotUsed)
+{
+    Grid grid {4};
+
+    grid.GetCell(Position{0, 0}).RemovePossibility(1);
+    grid.GetCell(Position{0, 0}).RemovePossibility(2);
+    grid.GetCell(Position{2, 3}).RemovePossibility(4);
+
+    EXPECT_TRUE(m_GridSolver4x4.Solve(grid));
+    EXPECT_THAT(m_GridStatusGetter.GetStatus(grid), Eq(GridStatus::SolvedCorrectly));
+
+    EXPECT_THAT(grid.GetCell(Position{0, 0}).GetValue(), AnyOf(Eq(3), Eq(4)));
+    EXPECT_THAT(grid.GetCell(Position{2, 3}).GetValue(), Ne(4));
+}
+
+TEST_F(TestDancingLinksGridSolver, LinksRestoredAfterEachSolve)
+{
+    Grid wrongGrid {4};
+    wrongGrid.GetCell(Position{1, 1}).SetValue(3);
+    wrongGrid.GetCell(Position{1, 2}).SetValue(3);
+
+    const auto positionsValues = CreateSolvedPositionsValues(4);
+
+    for (int i = 0; i < 3; i++)
+    {
+        auto grid = wrongGrid;
+        EXPECT_FALSE(m_GridSolver4x4.Solve(grid));
+
+        grid = CreateGrid(4, KeepRandomCells(positionsValues, 4));
+        EXPECT_TRUE(m_GridSolver4x4.Solve(grid));
+        EXPECT_THAT(m_GridStatusGetter.GetStatus(grid), Eq(GridStatus::SolvedCorrectly));
+    }
+}
+
+TEST_F(TestDancingLinksGridSolver, LinksRestoredWhenWritingSolutionThrows)
+{
+    const auto positionsValues = CreateSolvedPositionsValues(4);
+
+    {
+        // The possibilities of a grid whose modifications are recorded can't be replaced at once
+        auto grid = CreateGrid(4, KeepRandomCells(positionsValues, 4));
+        Trail trail {grid.GetCellsCount()};
+        ScopedTrail scopedTrail {grid, trail};
+
+        EXPECT_THROW(m_GridSolver4x4.Solve(grid), std::runtime_error);
+    }
+
+    auto grid = CreateGrid(4, KeepRandomCells(positionsValues, 4));
+    EXPECT_TRUE(m_GridSolver4x4.Solve(grid));
+    EXPECT_THAT(m_GridStatusGetter.GetStatus(grid), Eq(GridStatus::SolvedCorrectly));
+}
+
+TEST_F(TestDancingLinksGridSolver, GridOfOtherSizeThrows)
+{
+    Grid grid {4};
+
+    EXPECT_THROW(m_GridSolver9x9.Solve(grid), std::runtime_error);
+}
+
+} /* namespace test */
+} /* namespace sudoku */
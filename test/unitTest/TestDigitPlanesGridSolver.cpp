@@ -0,0 +1,158 @@
+#include "DigitPlanesGridSolver.hpp"
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <set>
+
+#include "Grid.hpp"
+#include "GridText.hpp"
+#include "GridStatus.hpp"
+#include "GridStatusGetter.hpp"
+#include "utils/Utils.hpp"
+
+using testing::Eq;
+
+namespace sudoku
+{
+namespace test
+{
+
+class TestDigitPlanesGridSolver : public ::testing::Test
+{
+public:
+    TestDigitPlanesGridSolver()
+    {}
+
+    DigitPlanesGridSolverImpl<4> m_GridSolver4x4;
+    DigitPlanesGridSolverImpl<9> m_GridSolver9x9;
+
+    GridStatusGetterImpl m_GridStatusGetter;
+};
+
+TEST_F(TestDigitPlanesGridSolver, SolveGridSolvedByPropagation)
+{
+    auto positionsValues = CreateSolvedPositionsValues(9);
+    positionsValues.erase(positionsValues.begin(), positionsValues.begin() + 9);
+
+    auto grid = CreateGrid(9, positionsValues);
+
+    EXPECT_TRUE(m_GridSolver9x9.Solve(grid));
+    EXPECT_THAT(m_GridStatusGetter.GetStatus(grid), Eq(GridStatus::SolvedCorrectly));
+}
+
+TEST_F(TestDigitPlanesGridSolver, SolveGridNeedingHypotheses)
+{
+    Grid grid {9};
+
+    EXPECT_TRUE(m_GridSolver9x9.Solve(grid));
+    EXPECT_THAT(m_GridStatusGetter.GetStatus(grid), Eq(GridStatus::SolvedCorrectly));
+}
+
+TEST_F(TestDigitPlanesGridSolver, CellsSetInGridKept)
+{
+    const auto positionsValues = CreatePositionsValues9x9();
+
+    auto grid = CreateGrid(9, KeepRandomCells(positionsValues, 20));
+    const auto gridBefore = grid;
+
+    EXPECT_TRUE(m_GridSolver9x9.Solve(grid));
+
+    for (int index = 0; index < grid.GetCellsCount(); index++)
+    {
+        if (gridBefore.GetPossibilities(index).OnlyOnePossibilityLeft())
+        {
+            EXPECT_THAT(grid.GetPossibilities(index), Eq(gridBefore.GetPossibilities(index)));
+        }
+    }
+}
+
+TEST_F(TestDigitPlanesGridSolver, WrongGridLeftUnchanged)
+{
+    Grid grid {4};
+
+    grid.GetCell(Position{0, 0}).SetValue(2);
+    grid.GetCell(Position{3, 0}).SetValue(2);
+
+    const auto gridBefore = grid;
+
+    EXPECT_FALSE(m_GridSolver4x4.Solve(grid));
+
+    for (int index = 0; index < grid.GetCellsCount(); index++)
+        EXPECT_THAT(grid.GetPossibilities(index), Eq(gridBefore.GetPossibilities(index)));
+}
+
+TEST_F(TestDigitPlanesGridSolver, CellWithNoPossibilityLeftIsWrong)
+{
+    Grid grid {4};
+
+    for (Value value = 1; value <= 4; value++)
+        grid.GetCell(Position{1, 2}).RemovePossibility(value);
+
+    EXPECT_FALSE(m_GridSolver4x4.Solve(grid));
+}
+
+TEST_F(TestDigitPlanesGridSolver, ValueWithNoCellLeftInUnitIsWrong)
+{
+    Grid grid {4};
+
+    for (int col = 0; col < 4; col++)
+        grid.GetCell(Position{2, col}).RemovePossibility(3);
+
+    EXPECT_FALSE(m_GridSolver4x4.Solve(grid));
+}
+
+TEST_F(TestDigitPlanesGridSolver, GridOfOtherSizeThrows)
+{
+    Grid grid {4};
+
+    EXPECT_THROW(m_GridSolver9x9.Solve(grid), std::runtime_error);
+}
+
+TEST_F(TestDigitPlanesGridSolver, SolutionsCountStoppedAtLimit)
+{
+    const Grid grid {4};
+
+    EXPECT_THAT(m_GridSolver4x4.CountSolutions(grid, 1'000), Eq(288));
+    EXPECT_THAT(m_GridSolver4x4.CountSolutions(grid, 2), Eq(2));
+}
+
+TEST_F(TestDigitPlanesGridSolver, NoSolutionCountedForWrongGrid)
+{
+    Grid grid {4};
+
+    for (int col = 0; col < 4; col++)
+        grid.GetCell(Position{2, col}).RemovePossibility(3);
+
+    EXPECT_THAT(m_GridSolver4x4.CountSolutions(grid, 2), Eq(0));
+}
+
+TEST_F(TestDigitPlanesGridSolver, DistinctSolutionsEnumerated)
+{
+    const auto grid = CreateGrid(4, {{Position {0, 0}, 1}});
+
+    std::set<std::string> solutions;
+
+    const auto solutionsCount = m_GridSolver4x4.EnumerateSolutions(grid, [&](Grid const& solution)
+        {
+            auto solvedGrid = solution;
+            EXPECT_THAT(m_GridStatusGetter.GetStatus(solvedGrid), Eq(GridStatus::SolvedCorrectly));
+            EXPECT_THAT(solution.GetCell(Position {0, 0}).GetValue(), Eq(1));
+
+            solutions.insert(FormatGrid(solution));
+            return true;
+        });
+
+    EXPECT_THAT(solutionsCount, Eq(72));
+    EXPECT_THAT(solutions.size(), Eq(72u));
+}
+
+TEST_F(TestDigitPlanesGridSolver, EnumerationStoppedByVisitor)
+{
+    const Grid grid {4};
+
+    EXPECT_THAT(m_GridSolver4x4.EnumerateSolutions(grid, [](Grid const&){ return false; }), Eq(1));
+}
+
+} /* namespace test */
+} /* namespace sudoku */
@@ -0,0 +1,338 @@
+#include "Grid.hpp"
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <sstream>
+
+#include "utils/Utils.hpp"
+
+using testing::Eq;
+
+namespace sudoku
+{
+namespace test
+{
+
+class TestGrid : public ::testing::Test
+{
+public:
+    TestGrid()
+    {}
+};
+
+TEST_F(TestGrid, CellPositionDerivedFromIndex)
+{
+    Grid grid {9};
+
+    const Position position {4, 7};
+    auto cell = grid.GetCell(position);
+
+    EXPECT_THAT(cell.GetIndex(), Eq(4 * 9 + 7));
+    EXPECT_THAT(cell.GetPosition(), Eq(position));
+    EXPECT_THAT(grid.GetCell(cell.GetIndex()).GetPosition(), Eq(position));
+}
+
+TEST_F(TestGrid, CellIsAViewOnTheGrid)
+{
+    Grid grid {4};
+
+    auto cell = grid.GetCell(Position{1, 2});
+    cell.SetValue(3);
+
+    EXPECT_THAT(grid.GetCell(Position{1, 2}).GetValue(), Eq(3));
+    EXPECT_THAT(grid.GetPossibilities(grid.GetIndex(Position{1, 2})), Eq(PossibilitiesBitSet{0b0100}));
+}
+
+TEST_F(TestGrid, CopyIsIndependent)
+{
+    Grid grid {9};
+    grid.GetCell(Position{0, 0}).SetValue(5);
+
+    auto copy = grid;
+    EXPECT_THAT(copy, Eq(grid));
+
+    copy.GetCell(Position{8, 8}).RemovePossibility(1);
+
+    EXPECT_FALSE(copy == grid);
+    EXPECT_THAT(grid.GetCell(Position{8, 8}).GetNumberPossibilitiesLeft(), Eq(9));
+    EXPECT_THAT(copy.GetCell(Position{0, 0}).GetValue(), Eq(5));
+}
+
+TEST_F(TestGrid, AssignmentCopiesGridSize)
+{
+    Grid grid {4};
+    Grid other {9};
+
+    other = grid;
+
+    EXPECT_THAT(other.GetGridSize(), Eq(4));
+    EXPECT_THAT(other, Eq(grid));
+}
+
+TEST_F(TestGrid, CopiesOfAllocatedGridsAreIndependent)
+{
+    for (const int gridSize : {16, 25})
+    {
+        Grid grid {gridSize};
+        grid.GetCell(Position{0, 0}).SetValue(5);
+
+        Grid copy {grid};
+        copy.GetCell(Position{gridSize - 1, gridSize - 1}).SetValue(2);
+
+        EXPECT_THAT(grid.GetUnsetCellsCount(), Eq(gridSize * gridSize - 1));
+        EXPECT_THAT(copy.GetUnsetCellsCount(), Eq(gridSize * gridSize - 2));
+        EXPECT_THAT(copy.GetCell(Position{0, 0}).GetValue(), Eq(5));
+
+        // Assigned over grids of smaller and of the same size
+        Grid other {9};
+        other = copy;
+        EXPECT_THAT(other, Eq(copy));
+
+        other = grid;
+        EXPECT_THAT(other, Eq(grid));
+        EXPECT_THAT(other.GetPlacedValues(gridSize), Eq(PossibilitiesBitSet{0b10000}));
+    }
+}
+
+TEST_F(TestGrid, MovedGridKeepsItsState)
+{
+    for (const int gridSize : {9, 16})
+    {
+        Grid grid {gridSize};
+        grid.GetCell(Position{1, 1}).SetValue(3);
+        grid.GetCell(Position{2, 2}).RemovePossibility(1);
+
+        const auto copy = grid;
+
+        Grid moved {std::move(grid)};
+        EXPECT_THAT(moved, Eq(copy));
+        EXPECT_THAT(moved.GetCellWithFewestPossibilities(), Eq(copy.GetCellWithFewestPossibilities()));
+
+        Grid assigned {4};
+        assigned = std::move(moved);
+        EXPECT_THAT(assigned, Eq(copy));
+        EXPECT_THAT(assigned.GetPlacedValues(gridSize + 1), Eq(PossibilitiesBitSet{0b100}));
+
+        // A grid moved from can be assigned again
+        moved = copy;
+        EXPECT_THAT(moved, Eq(copy));
+    }
+}
+
+TEST_F(TestGrid, RemoveLastPossibilityReturnsFalse)
+{
+    Grid grid {4};
+    auto cell = grid.GetCell(Position{0, 0});
+
+    EXPECT_TRUE(cell.RemovePossibility(1));
+    EXPECT_TRUE(cell.RemovePossibility(2));
+    EXPECT_TRUE(cell.RemovePossibility(3));
+    EXPECT_FALSE(cell.RemovePossibility(4));
+}
+
+TEST_F(TestGrid, UnitsOfCell)
+{
+    Grid grid {6};
+
+    auto const& cellSlots = grid.GetUnits().GetCellSlots(grid.GetIndex(Position{3, 4}));
+
+    EXPECT_THAT(cellSlots[0].m_Unit, Eq(4));
+    EXPECT_THAT(cellSlots[0].m_Slot, Eq(3));
+    EXPECT_THAT(cellSlots[1].m_Unit, Eq(6 + 3));
+    EXPECT_THAT(cellSlots[1].m_Slot, Eq(4));
+    EXPECT_THAT(cellSlots[2].m_Unit, Eq(12 + 3));
+    EXPECT_THAT(cellSlots[2].m_Slot, Eq(4));
+
+    for (auto const& [unit, slot] : cellSlots)
+        EXPECT_THAT(grid.GetUnits().GetCellIndex(unit, slot), Eq(grid.GetIndex(Position{3, 4})));
+}
+
+TEST_F(TestGrid, ValueLocationsFollowRemovedPossibilities)
+{
+    Grid grid {9};
+
+    grid.GetCell(Position{4, 7}).RemovePossibility(5);
+
+    EXPECT_THAT(grid.GetValueLocations(7, 5), Eq(UnitSlotsBitSet{0b111101111}));
+    EXPECT_THAT(grid.GetValueLocations(9 + 4, 5), Eq(UnitSlotsBitSet{0b101111111}));
+    EXPECT_THAT(grid.GetValueLocations(18 + 5, 5), Eq(UnitSlotsBitSet{0b111101111}));
+    EXPECT_THAT(grid.GetValueLocations(7, 4), Eq(UnitSlotsBitSet{0b111111111}));
+}
+
+TEST_F(TestGrid, PlacedValuesFollowSetValues)
+{
+    Grid grid {4};
+
+    grid.GetCell(Position{0, 0}).SetValue(3);
+    grid.GetCell(Position{1, 1}).SetValue(3);
+
+    EXPECT_THAT(grid.GetPlacedValues(0), Eq(PossibilitiesBitSet{0b0100}));
+    EXPECT_THAT(grid.GetPlacedValues(4 + 1), Eq(PossibilitiesBitSet{0b0100}));
+    EXPECT_THAT(grid.GetPlacedValues(8), Eq(PossibilitiesBitSet{0b0100}));
+    EXPECT_THAT(grid.GetPlacedValues(2), Eq(PossibilitiesBitSet{0}));
+
+    grid.GetCell(Position{0, 0}).RemovePossibility(3);
+
+    EXPECT_THAT(grid.GetPlacedValues(0), Eq(PossibilitiesBitSet{0}));
+    EXPECT_THAT(grid.GetPlacedValues(8), Eq(PossibilitiesBitSet{0b0100})) << "Still set in the other cell of the block";
+}
+
+TEST_F(TestGrid, UnitsRestoredOnRollBack)
+{
+    Grid grid {9};
+    grid.GetCell(Position{0, 0}).SetValue(1);
+
+    Trail trail {grid.GetCellsCount()};
+    ScopedTrail scopedTrail {grid, trail};
+
+    auto const expected = grid;
+    const auto checkpoint = grid.GetTrailCheckpoint();
+
+    grid.GetCell(Position{0, 0}).RemovePossibility(1);
+    grid.GetCell(Position{2, 2}).SetValue(7);
+    grid.GetCell(Position{5, 2}).RemovePossibility(7);
+
+    grid.RollBack(checkpoint);
+
+    for (int unit = 0; unit < grid.GetUnits().GetUnitsCount(); unit++)
+    {
+        EXPECT_THAT(grid.GetPlacedValues(unit), Eq(expected.GetPlacedValues(unit)));
+
+        for (Value value = 1; value <= grid.GetGridSize(); value++)
+            EXPECT_THAT(grid.GetValueLocations(unit, value), Eq(expected.GetValueLocations(unit, value)));
+    }
+}
+
+TEST_F(TestGrid, UnitsTouchedByRemovedPossibilities)
+{
+    Grid grid {9};
+
+    grid.GetCell(Position{4, 7}).RemovePossibility(5);
+
+    EXPECT_THAT(grid.TakeTouchedUnits(), Eq(GridUnits::UnitsBitSet{1 << 7, 1 << 4, 1 << 5}));
+    EXPECT_THAT(grid.TakeTouchedUnits(), Eq(GridUnits::UnitsBitSet{}));
+
+    grid.GetCell(Position{4, 7}).RemovePossibility(5);
+
+    EXPECT_THAT(grid.TakeTouchedUnits(), Eq(GridUnits::UnitsBitSet{})) << "Possibility already removed";
+}
+
+TEST_F(TestGrid, AllUnitsTouchedOnRollBack)
+{
+    Grid grid {4};
+
+    Trail trail {grid.GetCellsCount()};
+    ScopedTrail scopedTrail {grid, trail};
+
+    const auto checkpoint = grid.GetTrailCheckpoint();
+    grid.GetCell(Position{0, 0}).SetValue(1);
+    grid.TakeTouchedUnits();
+
+    grid.RollBack(checkpoint);
+
+    EXPECT_THAT(grid.TakeTouchedUnits(), Eq(GridUnits::UnitsBitSet{0b1111, 0b1111, 0b1111}));
+}
+
+TEST_F(TestGrid, UnsetCellsCountFollowsPossibilities)
+{
+    Grid grid {4};
+
+    EXPECT_THAT(grid.GetUnsetCellsCount(), Eq(16));
+
+    grid.GetCell(Position{0, 0}).SetValue(1);
+    grid.GetCell(Position{3, 2}).SetValue(4);
+
+    EXPECT_THAT(grid.GetUnsetCellsCount(), Eq(14));
+
+    grid.GetCell(Position{0, 0}).RemovePossibility(1);
+
+    EXPECT_THAT(grid.GetUnsetCellsCount(), Eq(15)) << "A cell without possibility isn't set";
+}
+
+TEST_F(TestGrid, CellWithFewestPossibilitiesFollowsPossibilities)
+{
+    Grid grid {9};
+
+    EXPECT_THAT(grid.GetCellWithFewestPossibilities(), Eq(0));
+
+    grid.GetCell(Position{0, 0}).SetValue(1);
+    grid.GetCell(Position{6, 2}).RemovePossibility(3);
+    grid.GetCell(Position{5, 8}).RemovePossibility(3);
+
+    EXPECT_THAT(grid.GetCellWithFewestPossibilities(), Eq(grid.GetIndex(Position{5, 8}))) << "Lowest index among the fewest";
+
+    grid.GetCell(Position{6, 2}).RemovePossibility(4);
+
+    EXPECT_THAT(grid.GetCellWithFewestPossibilities(), Eq(grid.GetIndex(Position{6, 2})));
+}
+
+TEST_F(TestGrid, NoCellWithFewestPossibilitiesWhenAllSet)
+{
+    auto grid = Create4x4CorrectlySolvedGrid();
+
+    EXPECT_THAT(grid.GetUnsetCellsCount(), Eq(0));
+    EXPECT_THAT(grid.GetCellWithFewestPossibilities(), Eq(-1));
+}
+
+TEST_F(TestGrid, PossibilitiesCountsRestoredOnRollBackAndCopy)
+{
+    Grid grid {9};
+
+    Trail trail {grid.GetCellsCount()};
+    ScopedTrail scopedTrail {grid, trail};
+
+    grid.GetCell(Position{2, 2}).RemovePossibility(1);
+    const auto checkpoint = grid.GetTrailCheckpoint();
+
+    grid.GetCell(Position{8, 8}).SetValue(1);
+    grid.GetCell(Position{7, 7}).RemovePossibility(1);
+    grid.GetCell(Position{7, 7}).RemovePossibility(2);
+
+    const auto copy = grid;
+    grid.RollBack(checkpoint);
+
+    EXPECT_THAT(grid.GetUnsetCellsCount(), Eq(81));
+    EXPECT_THAT(grid.GetCellWithFewestPossibilities(), Eq(grid.GetIndex(Position{2, 2})));
+
+    EXPECT_THAT(copy.GetUnsetCellsCount(), Eq(80));
+    EXPECT_THAT(copy.GetCellWithFewestPossibilities(), Eq(grid.GetIndex(Position{7, 7})));
+}
+
+TEST_F(TestGrid, GridSizeWithoutBlocksThrow)
+{
+    EXPECT_THROW(Grid {7}, std::exception);
+}
+
+TEST_F(TestGrid, GridWrittenOnOneLine)
+{
+    auto grid = Create4x4CorrectlySolvedGrid();
+    grid.GetCell(Position{3, 3}).RemovePossibility(3);
+    grid.GetCell(Position{3, 3}).RemovePossibility(2);
+
+    std::ostringstream os;
+    os << grid;
+
+    EXPECT_THAT(os.str(), Eq("123434122341412."));
+}
+
+TEST_F(TestGrid, PrettyGridDrawnWithBlocks)
+{
+    Grid grid {4};
+    grid.GetCell(Position{0, 1}).SetValue(2);
+    grid.GetCell(Position{3, 2}).SetValue(4);
+
+    std::ostringstream os;
+    os << PrettyGrid {grid};
+
+    EXPECT_THAT(os.str(), Eq("+----+----+\n"
+                             "|* 2 |* * |\n"
+                             "|* * |* * |\n"
+                             "+----+----+\n"
+                             "|* * |* * |\n"
+                             "|* * |4 * |\n"
+                             "+----+----+\n"));
+}
+
+} // namespace test
+} // namespace sudoku
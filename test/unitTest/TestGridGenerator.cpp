@@ -0,0 +1,125 @@
+#include "GridGenerator.hpp"
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <stdexcept>
+
+#include "DigitPlanesGridSolver.hpp"
+#include "Grid.hpp"
+
+using testing::Eq;
+using testing::Le;
+using testing::SizeIs;
+
+namespace sudoku
+{
+namespace test
+{
+
+class TestGridGenerator : public ::testing::Test
+{
+public:
+    TestGridGenerator()
+    {}
+
+    template<int TGridSize>
+    std::unique_ptr<GridGenerator> MakeGridGenerator()
+    {
+        m_PuzzleGeneration.m_GridSize = TGridSize;
+
+        return std::make_unique<GridGeneratorImpl>(std::make_unique<DigitPlanesGridSolverImpl<TGridSize>>(), m_PuzzleGeneration);
+    }
+
+    static int CountClues(Grid const& grid)
+    {
+        return grid.GetCellsCount() - grid.GetUnsetCellsCount();
+    }
+
+    PuzzleGeneration m_PuzzleGeneration;
+
+    DigitPlanesGridSolverImpl<9> m_SolutionsFinder9x9;
+};
+
+TEST_F(TestGridGenerator, GeneratedGridsHaveUniqueSolution)
+{
+    m_PuzzleGeneration.m_CluesCount = 30;
+
+    const auto grids = MakeGridGenerator<9>()->Generate(20, 0);
+
+    EXPECT_THAT(grids, SizeIs(20));
+
+    for (auto const& grid : grids)
+    {
+        EXPECT_THAT(CountClues(grid), Le(30));
+        EXPECT_THAT(m_SolutionsFinder9x9.CountSolutions(grid, 2), Eq(1));
+    }
+}
+
+TEST_F(TestGridGenerator, CluesSymmetric)
+{
+    m_PuzzleGeneration.m_CluesCount = 30;
+    m_PuzzleGeneration.m_Symmetry = Symmetry::Central;
+
+    for (auto const& grid : MakeGridGenerator<9>()->Generate(10, 0))
+    {
+        EXPECT_THAT(m_SolutionsFinder9x9.CountSolutions(grid, 2), Eq(1));
+
+        for (int row = 0; row < 9; row++)
+        {
+            for (int col = 0; col < 9; col++)
+                EXPECT_THAT(grid.GetCell(Position {row, col}).IsSet(), Eq(grid.GetCell(Position {8 - row, 8 - col}).IsSet()));
+        }
+    }
+}
+
+TEST_F(TestGridGenerator, GridDependsOnlyOnSeedAndIndex)
+{
+    auto gridGenerator = MakeGridGenerator<9>();
+
+    const auto grids = gridGenerator->Generate(4, 10);
+    const auto thirdGrid = gridGenerator->Generate(1, 12);
+
+    ASSERT_THAT(grids, SizeIs(4));
+    ASSERT_THAT(thirdGrid, SizeIs(1));
+    EXPECT_THAT(thirdGrid.front(), Eq(grids[2]));
+    EXPECT_THAT(grids[0] == grids[1], Eq(false));
+}
+
+TEST_F(TestGridGenerator, GridLeftOutWhenCluesCountNotReached)
+{
+    // A 4x4 grid with a unique solution has at least 4 clues
+    m_PuzzleGeneration.m_CluesCount = 3;
+    m_PuzzleGeneration.m_AttemptsCount = 2;
+
+    EXPECT_TRUE(MakeGridGenerator<4>()->Generate(3, 0).empty());
+}
+
+TEST_F(TestGridGenerator, NoClueThrows)
+{
+    m_PuzzleGeneration.m_CluesCount = 0;
+
+    EXPECT_THROW(MakeGridGenerator<4>(), std::runtime_error);
+}
+
+TEST_F(TestGridGenerator, UnsupportedGridSizeThrows)
+{
+    m_PuzzleGeneration.m_GridSize = 8;
+
+    EXPECT_THROW(GridGeneratorImpl(std::make_unique<DigitPlanesGridSolverImpl<9>>(), m_PuzzleGeneration), std::runtime_error);
+}
+
+TEST_F(TestGridGenerator, SymmetryOrbits)
+{
+    EXPECT_THAT(detail::GetSymmetryOrbits(4, Symmetry::None), SizeIs(16));
+    EXPECT_THAT(detail::GetSymmetryOrbits(4, Symmetry::Central), SizeIs(8));
+    EXPECT_THAT(detail::GetSymmetryOrbits(9, Symmetry::Central), SizeIs(41));
+    // 4 cells on the diagonal and 6 pairs
+    EXPECT_THAT(detail::GetSymmetryOrbits(4, Symmetry::Diagonal), SizeIs(10));
+
+    EXPECT_THAT(detail::GetSymmetryOrbits(4, Symmetry::Central).front(), Eq(std::vector<int> {0, 15}));
+    EXPECT_THAT(detail::GetSymmetryOrbits(4, Symmetry::Diagonal)[1], Eq(std::vector<int> {1, 4}));
+}
+
+} /* namespace test */
+} /* namespace sudoku */
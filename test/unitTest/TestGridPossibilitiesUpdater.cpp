@@ -28,7 +28,7 @@ public:
 
     std::unique_ptr<GridPossibilitiesUpdater> MakeGridPossibilitiesUpdater()
     {
-        return std::make_unique<GridPossibilitiesUpdaterImpl>(
+        return std::make_unique<GridPossibilitiesUpdaterImpl<>>(
                     std::move(m_RelatedPossibilitiesRemover));
     }
 
@@ -44,7 +44,7 @@ TEST_F(TestGridPossibilitiesUpdater, UpdateGridWithEmptyFoundPositions)
 {
     EXPECT_CALL(*m_RelatedPossibilitiesRemover, UpdateRelatedPossibilities(_, Ref(m_Grid), Ref(*m_FoundPositions))).Times(0);
 
-    MakeGridPossibilitiesUpdater()->UpdateGrid(*m_FoundPositions, m_Grid);
+    EXPECT_TRUE(MakeGridPossibilitiesUpdater()->UpdateGrid(*m_FoundPositions, m_Grid));
 
     EXPECT_TRUE(m_FoundPositions->empty());
 }
@@ -55,14 +55,27 @@ TEST_F(TestGridPossibilitiesUpdater, UpdateGrid)
     m_FoundPositions->push(Position {0, 1});
     m_FoundPositions->push(Position {0, 2});
 
-    EXPECT_CALL(*m_RelatedPossibilitiesRemover, UpdateRelatedPossibilities(Position {0, 0}, Ref(m_Grid), Ref(*m_FoundPositions))).Times(1);
-    EXPECT_CALL(*m_RelatedPossibilitiesRemover, UpdateRelatedPossibilities(Position {0, 1}, Ref(m_Grid), Ref(*m_FoundPositions))).Times(1);
-    EXPECT_CALL(*m_RelatedPossibilitiesRemover, UpdateRelatedPossibilities(Position {0, 2}, Ref(m_Grid), Ref(*m_FoundPositions))).Times(1);
+    EXPECT_CALL(*m_RelatedPossibilitiesRemover, UpdateRelatedPossibilities(Position {0, 0}, Ref(m_Grid), Ref(*m_FoundPositions))).WillOnce(Return(true));
+    EXPECT_CALL(*m_RelatedPossibilitiesRemover, UpdateRelatedPossibilities(Position {0, 1}, Ref(m_Grid), Ref(*m_FoundPositions))).WillOnce(Return(true));
+    EXPECT_CALL(*m_RelatedPossibilitiesRemover, UpdateRelatedPossibilities(Position {0, 2}, Ref(m_Grid), Ref(*m_FoundPositions))).WillOnce(Return(true));
 
-    MakeGridPossibilitiesUpdater()->UpdateGrid(*m_FoundPositions, m_Grid);
+    EXPECT_TRUE(MakeGridPossibilitiesUpdater()->UpdateGrid(*m_FoundPositions, m_Grid));
 
     EXPECT_TRUE(m_FoundPositions->empty());
 }
 
+TEST_F(TestGridPossibilitiesUpdater, UpdateGridStopsOnContradiction)
+{
+    m_FoundPositions->push(Position {0, 0});
+    m_FoundPositions->push(Position {0, 1});
+    m_FoundPositions->push(Position {0, 2});
+
+    EXPECT_CALL(*m_RelatedPossibilitiesRemover, UpdateRelatedPossibilities(Position {0, 0}, Ref(m_Grid), Ref(*m_FoundPositions))).WillOnce(Return(true));
+    EXPECT_CALL(*m_RelatedPossibilitiesRemover, UpdateRelatedPossibilities(Position {0, 1}, Ref(m_Grid), Ref(*m_FoundPositions))).WillOnce(Return(false));
+    EXPECT_CALL(*m_RelatedPossibilitiesRemover, UpdateRelatedPossibilities(Position {0, 2}, Ref(m_Grid), Ref(*m_FoundPositions))).Times(0);
+
+    EXPECT_FALSE(MakeGridPossibilitiesUpdater()->UpdateGrid(*m_FoundPositions, m_Grid));
+}
+
 } /* namespace test */
 } /* namespace sudoku */
@@ -0,0 +1,156 @@
+#include "GridRecords.hpp"
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <sstream>
+#include <stdexcept>
+
+#include "utils/Utils.hpp"
+
+using testing::Eq;
+using testing::Lt;
+
+namespace sudoku
+{
+namespace test
+{
+
+class TestGridRecords : public ::testing::Test
+{
+public:
+    TestGridRecords()
+    {}
+
+    std::ostringstream m_Output;
+};
+
+TEST_F(TestGridRecords, GridRecordSize)
+{
+    EXPECT_THAT(GetGridRecordSize(4), Eq(6u)) << "3 bits per value";
+    EXPECT_THAT(GetGridRecordSize(9), Eq(41u)) << "4 bits per value";
+    EXPECT_THAT(GetGridRecordSize(16), Eq(160u)) << "5 bits per value";
+    EXPECT_THAT(GetGridRecordSize(25), Eq(391u)) << "5 bits per value";
+}
+
+TEST_F(TestGridRecords, GridsReadBack)
+{
+    for (int gridSize : {4, 6, 9, 16, 25})
+    {
+        SCOPED_TRACE(gridSize);
+
+        const auto positionsValues = CreateSolvedPositionsValues(gridSize);
+        const std::vector<Grid> grids {CreateGrid(gridSize, KeepRandomCells(positionsValues, gridSize)),
+                                       CreateGrid(gridSize, positionsValues),
+                                       Grid {gridSize}};
+
+        {
+            GridRecordsWriter writer {m_Output, GridRecordsKind::Grids, gridSize};
+
+            for (auto const& grid : grids)
+                writer.Write(grid);
+        }
+
+        const auto data = m_Output.str();
+        m_Output.str("");
+
+        EXPECT_THAT(data.size(), Eq(GridRecordsHeaderSize + grids.size() * GetGridRecordSize(gridSize)));
+
+        GridRecordsReader reader {data};
+
+        EXPECT_THAT(reader.GetHeader().m_Version, Eq(GridRecordsVersion));
+        EXPECT_THAT(reader.GetHeader().m_GridSize, Eq(gridSize));
+
+        for (auto const& grid : grids)
+            EXPECT_THAT(reader.Read(), Eq(grid));
+
+        EXPECT_TRUE(reader.IsOver());
+    }
+}
+
+TEST_F(TestGridRecords, SolutionsOfGridsReadBack)
+{
+    const auto positionsValues = CreatePositionsValues9x9();
+    const auto solution = CreateGrid(9, positionsValues);
+
+    std::vector<Grid> grids;
+
+    for (int cellsKept : {17, 30, 81})
+        grids.push_back(CreateGrid(9, KeepRandomCells(positionsValues, cellsKept)));
+
+    {
+        GridRecordsWriter writer {m_Output, GridRecordsKind::SolutionsOfGrids, 9};
+
+        for (auto const& grid : grids)
+            writer.Write(grid, solution);
+    }
+
+    const auto data = m_Output.str();
+
+    EXPECT_THAT(data.size(), Lt(GridRecordsHeaderSize + grids.size() * GetGridRecordSize(9))) << "Given cells not stored";
+
+    GridRecordsReader reader {data};
+
+    for (auto const& grid : grids)
+        EXPECT_THAT(reader.Read(grid), Eq(solution));
+
+    EXPECT_TRUE(reader.IsOver());
+}
+
+TEST_F(TestGridRecords, SolutionOfAnotherGridThrows)
+{
+    const auto positionsValues = CreatePositionsValues9x9();
+
+    {
+        GridRecordsWriter writer {m_Output, GridRecordsKind::SolutionsOfGrids, 9};
+        writer.Write(CreateGrid(9, {positionsValues[0]}), CreateGrid(9, positionsValues));
+    }
+
+    GridRecordsReader reader {m_Output.str()};
+
+    EXPECT_THROW(reader.Read(CreateGrid(9, {positionsValues[1]})), std::runtime_error);
+}
+
+TEST_F(TestGridRecords, RecordOfWrongKindThrows)
+{
+    GridRecordsWriter writer {m_Output, GridRecordsKind::Grids, 9};
+
+    EXPECT_THROW(writer.Write(Grid {9}, Grid {9}), std::runtime_error);
+    EXPECT_THROW(writer.Write(Grid {4}), std::runtime_error) << "Grid of another size";
+
+    writer.Write(Grid {9});
+    writer.Flush();
+
+    GridRecordsReader reader {m_Output.str()};
+
+    EXPECT_THROW(reader.Read(Grid {9}), std::runtime_error);
+}
+
+TEST_F(TestGridRecords, InvalidDataThrows)
+{
+    {
+        GridRecordsWriter writer {m_Output, GridRecordsKind::Grids, 9};
+        writer.Write(Grid {9});
+    }
+
+    auto data = m_Output.str();
+
+    EXPECT_THROW(GridRecordsReader {data.substr(1)}, std::runtime_error) << "No magic number";
+
+    GridRecordsReader truncatedReader {data.substr(0, data.size() - 1)};
+    EXPECT_THROW(truncatedReader.Read(), std::runtime_error);
+
+    auto otherVersionData = data;
+    otherVersionData[4]++;
+    EXPECT_THROW(GridRecordsReader {otherVersionData}, std::runtime_error);
+
+    // 15 doesn't fit in a 9x9 grid
+    auto invalidValueData = data;
+    invalidValueData[GridRecordsHeaderSize] = 0x0F;
+
+    GridRecordsReader invalidValueReader {invalidValueData};
+    EXPECT_THROW(invalidValueReader.Read(), std::runtime_error);
+}
+
+} /* namespace test */
+} /* namespace sudoku */
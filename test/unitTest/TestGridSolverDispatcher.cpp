@@ -0,0 +1,64 @@
+#include "GridSolverDispatcher.hpp"
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include "Grid.hpp"
+
+#include "mock/MockGridSolverWithHypothesis.hpp"
+
+using testing::Ref;
+using testing::Return;
+using testing::StrictMock;
+
+namespace sudoku
+{
+namespace test
+{
+
+class TestGridSolverDispatcher : public ::testing::Test
+{
+public:
+    TestGridSolverDispatcher()
+    {}
+
+    std::unique_ptr<GridSolver> MakeGridSolverDispatcher()
+    {
+        std::unordered_map<int, std::unique_ptr<GridSolver>> gridSolvers;
+        gridSolvers.emplace(4, std::move(m_GridSolver4x4));
+        gridSolvers.emplace(9, std::move(m_GridSolver9x9));
+
+        return std::make_unique<GridSolverDispatcherImpl>(std::move(gridSolvers));
+    }
+
+    std::unique_ptr<MockGridSolver> m_GridSolver4x4 = std::make_unique<StrictMock<MockGridSolver>>();
+    std::unique_ptr<MockGridSolver> m_GridSolver9x9 = std::make_unique<StrictMock<MockGridSolver>>();
+};
+
+TEST_F(TestGridSolverDispatcher, DispatchToSolverOfGridSize)
+{
+    Grid grid {9};
+
+    EXPECT_CALL(*m_GridSolver9x9, Solve(Ref(grid))).WillOnce(Return(true));
+
+    EXPECT_TRUE(MakeGridSolverDispatcher()->Solve(grid));
+}
+
+TEST_F(TestGridSolverDispatcher, ReturnSolverResult)
+{
+    Grid grid {4};
+
+    EXPECT_CALL(*m_GridSolver4x4, Solve(Ref(grid))).WillOnce(Return(false));
+
+    EXPECT_FALSE(MakeGridSolverDispatcher()->Solve(grid));
+}
+
+TEST_F(TestGridSolverDispatcher, NoSolverForGridSizeThrow)
+{
+    Grid grid {6};
+
+    EXPECT_THROW(MakeGridSolverDispatcher()->Solve(grid), std::exception);
+}
+
+} /* namespace test */
+} /* namespace sudoku */
@@ -8,6 +8,7 @@
 #include "Grid.hpp"
 
 #include "mock/MockGridSolverWithoutHypothesis.hpp"
+#include "mock/MockBranchingStrategy.hpp"
 
 using testing::_;
 using testing::Eq;
@@ -30,11 +31,20 @@ public:
 
     std::unique_ptr<GridSolver> MakeGridSolverWithHypothesis()
     {
-        return std::make_unique<GridSolverWithHypothesisImpl>(
-                    std::move(m_GridSolverWithoutHypothesis));
+        return std::make_unique<GridSolverWithHypothesisImpl<>>(
+                    std::move(m_GridSolverWithoutHypothesis),
+                    std::move(m_BranchingStrategy));
+    }
+
+    std::unique_ptr<SolutionsFinder> MakeSolutionsFinder()
+    {
+        return std::make_unique<GridSolverWithHypothesisImpl<>>(
+                    std::move(m_GridSolverWithoutHypothesis),
+                    std::move(m_BranchingStrategy));
     }
 
     std::unique_ptr<MockGridSolverWithoutHypothesis> m_GridSolverWithoutHypothesis = std::make_unique<StrictMock<MockGridSolverWithoutHypothesis>>();
+    std::unique_ptr<BranchingStrategy> m_BranchingStrategy = std::make_unique<FewestPossibilitiesBranchingImpl>();
 };
 
 TEST_F(TestGridSolverWithHypothesis, GridSolvedWithoutHypthesis)
@@ -121,6 +131,48 @@ TEST_F(TestGridSolverWithHypothesis, GridSolvedAfterSeveralHypthesisOnCell)
     EXPECT_THAT(grid, Eq(hypothesisGrid2));
 }
 
+TEST_F(TestGridSolverWithHypothesis, GridRestoredAfterWrongHypotheses)
+{
+    const int gridSize {4};
+    Grid grid {gridSize};
+
+    Position hypothesisCellPosition {1, 2};
+
+    grid.GetCell(Position {0, 1}).SetValue(4);
+    grid.GetCell(Position {3, 2}).SetValue(2);
+    grid.GetCell(hypothesisCellPosition).RemovePossibility(4);
+
+    Grid hypothesisGrid1 {grid};
+    hypothesisGrid1.GetCell(hypothesisCellPosition).SetValue(3);
+
+    Grid hypothesisGrid2 {grid};
+    hypothesisGrid2.GetCell(hypothesisCellPosition).SetValue(2);
+
+    Grid hypothesisGrid3 {grid};
+    hypothesisGrid3.GetCell(hypothesisCellPosition).SetValue(1);
+
+    auto modifyGridAndFail = [](Grid& hypothesisGrid, FoundPositions&)
+    {
+        hypothesisGrid.GetCell(Position {2, 2}).SetValue(3);
+        hypothesisGrid.GetCell(Position {3, 3}).RemovePossibility(1);
+        return GridStatus::Wrong;
+    };
+
+    {
+    InSequence s;
+    EXPECT_CALL(*m_GridSolverWithoutHypothesis, Solve(Ref(grid), _)).WillOnce(Return(GridStatus::Incomplete));
+    EXPECT_CALL(*m_GridSolverWithoutHypothesis, Solve(hypothesisGrid1, _)).WillOnce(Invoke(modifyGridAndFail));
+    EXPECT_CALL(*m_GridSolverWithoutHypothesis, Solve(hypothesisGrid2, _)).WillOnce(Invoke(modifyGridAndFail));
+    EXPECT_CALL(*m_GridSolverWithoutHypothesis, Solve(hypothesisGrid3, _)).WillOnce(Return(GridStatus::SolvedCorrectly));
+    }
+
+    auto correctlySolved = MakeGridSolverWithHypothesis()->Solve(grid);
+
+    EXPECT_TRUE(correctlySolved);
+    EXPECT_THAT(grid, Eq(hypothesisGrid3));
+    EXPECT_THAT(grid.GetTrail(), Eq(nullptr));
+}
+
 TEST_F(TestGridSolverWithHypothesis, GridSolvedWrongAfterSeveralHypthesisOnCell)
 {
     const int gridSize {4};
@@ -185,6 +237,168 @@ TEST_F(TestGridSolverWithHypothesis, GridSolvedAfterSeveralHypthesisOnDifferentC
     EXPECT_THAT(grid, Eq(hypothesisGrid2));
 }
 
+TEST_F(TestGridSolverWithHypothesis, GridSolvedWrongAfterHypothesesOnAllCellsOfUnit)
+{
+    const int gridSize {4};
+    Grid grid {gridSize};
+
+    const int row1Unit {gridSize + 1};
+    const Value branchValue {3};
+
+    grid.GetCell(Position {1, 0}).RemovePossibility(branchValue);
+    grid.GetCell(Position {1, 3}).RemovePossibility(branchValue);
+
+    Grid hypothesisGrid1 {grid};
+    hypothesisGrid1.GetCell(Position {1, 1}).SetValue(branchValue);
+
+    Grid hypothesisGrid2 {grid};
+    hypothesisGrid2.GetCell(Position {1, 1}).RemovePossibility(branchValue);
+    hypothesisGrid2.GetCell(Position {1, 2}).SetValue(branchValue);
+
+    auto branchingStrategy = std::make_unique<StrictMock<MockBranchingStrategy>>();
+    const Branch branch {Branch::Kind::UnitCells, {}, row1Unit, branchValue};
+
+    {
+    InSequence s;
+    EXPECT_CALL(*m_GridSolverWithoutHypothesis, Solve(Ref(grid), _)).WillOnce(Return(GridStatus::Incomplete));
+    EXPECT_CALL(*branchingStrategy, SelectBranch(Ref(grid))).WillOnce(Return(branch));
+    EXPECT_CALL(*branchingStrategy, SelectHypothesis(Ref(grid), _)).WillOnce(Return(Hypothesis {Position {1, 1}, branchValue}));
+    EXPECT_CALL(*m_GridSolverWithoutHypothesis, Solve(hypothesisGrid1, _)).WillOnce(Return(GridStatus::Wrong));
+    EXPECT_CALL(*branchingStrategy, SelectHypothesis(Ref(grid), _)).WillOnce(Return(Hypothesis {Position {1, 2}, branchValue}));
+    EXPECT_CALL(*m_GridSolverWithoutHypothesis, Solve(hypothesisGrid2, _)).WillOnce(Return(GridStatus::Wrong));
+    }
+
+    m_BranchingStrategy = std::move(branchingStrategy);
+
+    auto correctlySolved = MakeGridSolverWithHypothesis()->Solve(grid);
+
+    EXPECT_FALSE(correctlySolved) << "No cell of the unit left for the value";
+}
+
+TEST_F(TestGridSolverWithHypothesis, SearchGivenUpWhenStopRequested)
+{
+    const int gridSize {4};
+    Grid grid {gridSize};
+
+    Trail trail {grid.GetCellsCount()};
+    ScopedTrail scopedTrail {grid, trail};
+    FoundPositions foundPositions;
+
+    auto stopped = detail::SolveWithtHypothesis(grid, foundPositions, *m_GridSolverWithoutHypothesis, *m_BranchingStrategy, []{ return true; });
+
+    EXPECT_FALSE(stopped);
+}
+
+TEST_F(TestGridSolverWithHypothesis, SolutionsCountedAfterFirstSolution)
+{
+    const int gridSize {4};
+    Grid grid {gridSize};
+
+    Position hypothesisCellPosition {1, 2};
+
+    grid.GetCell(Position {0, 1}).SetValue(4);
+    grid.GetCell(Position {3, 2}).SetValue(2);
+    grid.GetCell(Position {1, 0}).RemovePossibility(3);
+    grid.GetCell(hypothesisCellPosition).RemovePossibility(4);
+    grid.GetCell(hypothesisCellPosition).RemovePossibility(3);
+
+    const Grid initialGrid {grid};
+
+    Grid hypothesisGrid1 {grid};
+    hypothesisGrid1.GetCell(hypothesisCellPosition).SetValue(2);
+
+    Grid hypothesisGrid2 {grid};
+    hypothesisGrid2.GetCell(hypothesisCellPosition).SetValue(1);
+
+    {
+    InSequence s;
+    EXPECT_CALL(*m_GridSolverWithoutHypothesis, Solve(Eq(initialGrid), _)).WillOnce(Return(GridStatus::Incomplete));
+    EXPECT_CALL(*m_GridSolverWithoutHypothesis, Solve(hypothesisGrid1, _)).WillOnce(Return(GridStatus::SolvedCorrectly));
+    EXPECT_CALL(*m_GridSolverWithoutHypothesis, Solve(hypothesisGrid2, _)).WillOnce(Return(GridStatus::SolvedCorrectly));
+    }
+
+    const auto solutionsCount = MakeSolutionsFinder()->CountSolutions(grid, 3);
+
+    EXPECT_THAT(solutionsCount, Eq(2));
+    EXPECT_THAT(grid, Eq(initialGrid));
+}
+
+TEST_F(TestGridSolverWithHypothesis, SolutionsCountStoppedAtLimit)
+{
+    const int gridSize {4};
+    Grid grid {gridSize};
+
+    Position hypothesisCellPosition {1, 2};
+
+    grid.GetCell(Position {0, 1}).SetValue(4);
+    grid.GetCell(Position {3, 2}).SetValue(2);
+    grid.GetCell(Position {1, 0}).RemovePossibility(3);
+    grid.GetCell(hypothesisCellPosition).RemovePossibility(4);
+    grid.GetCell(hypothesisCellPosition).RemovePossibility(3);
+
+    Grid hypothesisGrid1 {grid};
+    hypothesisGrid1.GetCell(hypothesisCellPosition).SetValue(2);
+
+    {
+    InSequence s;
+    EXPECT_CALL(*m_GridSolverWithoutHypothesis, Solve(Eq(grid), _)).WillOnce(Return(GridStatus::Incomplete));
+    EXPECT_CALL(*m_GridSolverWithoutHypothesis, Solve(hypothesisGrid1, _)).WillOnce(Return(GridStatus::SolvedCorrectly));
+    }
+
+    const auto solutionsCount = MakeSolutionsFinder()->CountSolutions(grid, 1);
+
+    EXPECT_THAT(solutionsCount, Eq(1));
+}
+
+TEST_F(TestGridSolverWithHypothesis, NoSolutionCountedForWrongGrid)
+{
+    const int gridSize {4};
+    Grid grid {gridSize};
+
+    EXPECT_CALL(*m_GridSolverWithoutHypothesis, Solve(Eq(grid), _)).WillOnce(Return(GridStatus::Wrong));
+
+    const auto solutionsCount = MakeSolutionsFinder()->CountSolutions(grid, 2);
+
+    EXPECT_THAT(solutionsCount, Eq(0));
+}
+
+TEST_F(TestGridSolverWithHypothesis, SolutionsEnumeratedUntilVisitorStops)
+{
+    const int gridSize {4};
+    Grid grid {gridSize};
+
+    Position hypothesisCellPosition {1, 2};
+
+    grid.GetCell(Position {0, 1}).SetValue(4);
+    grid.GetCell(Position {3, 2}).SetValue(2);
+    grid.GetCell(Position {1, 0}).RemovePossibility(3);
+    grid.GetCell(hypothesisCellPosition).RemovePossibility(4);
+    grid.GetCell(hypothesisCellPosition).RemovePossibility(3);
+
+    Grid hypothesisGrid1 {grid};
+    hypothesisGrid1.GetCell(hypothesisCellPosition).SetValue(2);
+
+    Grid hypothesisGrid2 {grid};
+    hypothesisGrid2.GetCell(hypothesisCellPosition).SetValue(1);
+
+    {
+    InSequence s;
+    EXPECT_CALL(*m_GridSolverWithoutHypothesis, Solve(Eq(grid), _)).WillOnce(Return(GridStatus::Incomplete));
+    EXPECT_CALL(*m_GridSolverWithoutHypothesis, Solve(hypothesisGrid1, _)).WillOnce(Return(GridStatus::SolvedCorrectly));
+    EXPECT_CALL(*m_GridSolverWithoutHypothesis, Solve(hypothesisGrid2, _)).WillOnce(Return(GridStatus::SolvedCorrectly));
+    }
+
+    std::vector<Grid> solutions;
+
+    const auto solutionsCount = MakeSolutionsFinder()->EnumerateSolutions(grid, [&solutions](Grid const& solution)
+        {
+            solutions.push_back(solution);
+            return solutions.size() < 2;
+        });
+
+    EXPECT_THAT(solutionsCount, Eq(2));
+    EXPECT_THAT(solutions, testing::ElementsAre(hypothesisGrid1, hypothesisGrid2));
+}
 
 } /* namespace test */
 } /* namespace sudoku */
@@ -11,6 +11,7 @@
 
 #include "mock/MockGridPossibilitiesUpdater.hpp"
 #include "mock/MockUniquePossibilitySetter.hpp"
+#include "mock/MockPatternPossibilitiesRemover.hpp"
 #include "utils/Utils.hpp"
 
 using testing::_;
@@ -35,15 +36,16 @@ public:
 
     std::unique_ptr<GridSolverWithoutHypothesis> MakeGridSolverWithoutHypothesis()
     {
-        return std::make_unique<GridSolverWithoutHypothesisImpl>(
+        return std::make_unique<GridSolverWithoutHypothesisImpl<>>(
                     std::move(m_GridPossibilitiesUpdater),
-                    std::move(m_UniquePossibilitySetter));
+                    std::move(m_UniquePossibilitySetter),
+                    std::move(m_PatternPossibilitiesRemover));
     }
 
     void ExpectUpdateGrid(Grid& grid)
     {
         EXPECT_CALL(*m_GridPossibilitiesUpdater, UpdateGrid(_, Ref(grid)))
-                .WillOnce(Invoke([](FoundPositions& foundPositions, Grid&){ while(!foundPositions.empty()) { foundPositions.pop();} }));
+                .WillOnce(Invoke([](FoundPositions& foundPositions, Grid&){ while(!foundPositions.empty()) { foundPositions.pop();} return true; }));
     }
 
     void ExpectUpdateGrid_SolveGrid(Grid& grid)
@@ -52,33 +54,62 @@ public:
                 .WillOnce(Invoke([](FoundPositions& foundPositions, Grid& grid)
                     {
                         while(!foundPositions.empty()) { foundPositions.pop();}
-                        for (auto& cell : grid) { if (!cell.GetValue()) cell.SetValue(1); }
+                        for (auto cell : grid) { if (!cell.GetValue()) cell.SetValue(1); }
+                        return true;
                     }));
     }
 
     void ExpectSetCellsWithUniquePossibility_FoundPositions(Grid& grid, Position const& newFoundPosition)
     {
         EXPECT_CALL(*m_UniquePossibilitySetter, SetCellsWithUniquePossibility(Ref(grid), _))
-                .WillOnce(Invoke([&newFoundPosition](Grid&, FoundPositions& foundPositions){ foundPositions.push(newFoundPosition); }));
+                .WillOnce(Invoke([&newFoundPosition](Grid&, FoundPositions& foundPositions){ foundPositions.push(newFoundPosition); return true; }));
     }
 
     void ExpectSetCellsWithUniquePossibility_NoCellFound(Grid& grid)
     {
-        EXPECT_CALL(*m_UniquePossibilitySetter, SetCellsWithUniquePossibility(Ref(grid), _)).Times(1);
+        EXPECT_CALL(*m_UniquePossibilitySetter, SetCellsWithUniquePossibility(Ref(grid), _)).WillOnce(Return(true));
+    }
+
+    void ExpectRemovePossibilities_FoundPositions(Grid& grid, Position const& newFoundPosition)
+    {
+        EXPECT_CALL(*m_PatternPossibilitiesRemover, RemovePossibilities(Ref(grid), _, _))
+                .WillOnce(Invoke([&newFoundPosition](Grid&, FoundPositions& foundPositions, bool& possibilitiesRemoved)
+                    {
+                        foundPositions.push(newFoundPosition);
+                        possibilitiesRemoved = true;
+                        return true;
+                    }));
+    }
+
+    void ExpectRemovePossibilities_NoCellFound(Grid& grid)
+    {
+        EXPECT_CALL(*m_PatternPossibilitiesRemover, RemovePossibilities(Ref(grid), _, _))
+                .WillOnce(Invoke([](Grid&, FoundPositions&, bool& possibilitiesRemoved){ possibilitiesRemoved = true; return true; }));
+    }
+
+    void ExpectRemovePossibilities_NothingRemoved(Grid& grid)
+    {
+        EXPECT_CALL(*m_PatternPossibilitiesRemover, RemovePossibilities(Ref(grid), _, _))
+                .WillOnce(Invoke([](Grid&, FoundPositions&, bool& possibilitiesRemoved){ possibilitiesRemoved = false; return true; }));
     }
 
     FoundPositions m_FoundPositions;
 
     std::unique_ptr<MockGridPossibilitiesUpdater> m_GridPossibilitiesUpdater = std::make_unique<StrictMock<MockGridPossibilitiesUpdater>>();
     std::unique_ptr<MockUniquePossibilitySetter> m_UniquePossibilitySetter = std::make_unique<StrictMock<MockUniquePossibilitySetter>>();
+    std::unique_ptr<MockPatternPossibilitiesRemover> m_PatternPossibilitiesRemover = std::make_unique<StrictMock<MockPatternPossibilitiesRemover>>();
 };
 
-TEST_F(TestGridSolverWithoutHypothesis, EmptyFoundPositionsInThrow)
+TEST_F(TestGridSolverWithoutHypothesis, EmptyFoundPositionsIsIncomplete)
 {
     const int gridSize {4};
     Grid grid {gridSize};
 
-    EXPECT_THROW(MakeGridSolverWithoutHypothesis()->Solve(grid, m_FoundPositions), std::exception);
+    ExpectRemovePossibilities_NothingRemoved(grid);
+
+    auto gridStatus = MakeGridSolverWithoutHypothesis()->Solve(grid, m_FoundPositions);
+
+    EXPECT_THAT(gridStatus, Eq(GridStatus::Incomplete));
 }
 
 TEST_F(TestGridSolverWithoutHypothesis, CouldntResolveIfUpdateGridFail)
@@ -90,7 +121,7 @@ TEST_F(TestGridSolverWithoutHypothesis, CouldntResolveIfUpdateGridFail)
             .WillRepeatedly(Invoke([](FoundPositions& foundPositions, Grid& grid)
                 {
                     foundPositions.push(Position {2, 3});
-                    throw std::runtime_error("exception");
+                    return false;
                 }));
 
     auto gridStatus = MakeGridSolverWithoutHypothesis()->Solve(grid, m_FoundPositions);
@@ -99,7 +130,7 @@ TEST_F(TestGridSolverWithoutHypothesis, CouldntResolveIfUpdateGridFail)
     EXPECT_TRUE(m_FoundPositions.empty());
 }
 
-TEST_F(TestGridSolverWithoutHypothesis, CouldntResolveIfSetCellsWithUniquePossibilityThrow)
+TEST_F(TestGridSolverWithoutHypothesis, CouldntResolveIfSetCellsWithUniquePossibilityFail)
 {
     Grid grid = Create4x4CorrectlyPartiallyFilledGrid();
     m_FoundPositions.push(Position {0, 0});
@@ -111,7 +142,7 @@ TEST_F(TestGridSolverWithoutHypothesis, CouldntResolveIfSetCellsWithUniquePossib
             .WillRepeatedly(Invoke([](Grid& grid, FoundPositions& foundPositions)
                 {
                     foundPositions.push(Position {2, 3});
-                    throw std::runtime_error("exception");
+                    return false;
                 }));
     }
 
@@ -121,6 +152,17 @@ TEST_F(TestGridSolverWithoutHypothesis, CouldntResolveIfSetCellsWithUniquePossib
     EXPECT_TRUE(m_FoundPositions.empty());
 }
 
+TEST_F(TestGridSolverWithoutHypothesis, UpdateGridExceptionIsNotCaught)
+{
+    Grid grid = Create4x4CorrectlyPartiallyFilledGrid();
+    m_FoundPositions.push(Position {0, 0});
+
+    EXPECT_CALL(*m_GridPossibilitiesUpdater, UpdateGrid(_, Ref(grid)))
+            .WillOnce(Throw(std::runtime_error("exception")));
+
+    EXPECT_THROW(MakeGridSolverWithoutHypothesis()->Solve(grid, m_FoundPositions), std::exception);
+}
+
 TEST_F(TestGridSolverWithoutHypothesis, GridSolvedAfterFirstUpdateGrid)
 {
     Grid grid = Create4x4CorrectlyPartiallyFilledGrid();
@@ -147,6 +189,7 @@ TEST_F(TestGridSolverWithoutHypothesis, GridNotSolvedAfterFirstUpdateGrid)
     InSequence s;
     ExpectUpdateGrid(grid);
     ExpectSetCellsWithUniquePossibility_NoCellFound(grid);
+    ExpectRemovePossibilities_NothingRemoved(grid);
     }
 
     auto gridStatus = MakeGridSolverWithoutHypothesis()->Solve(grid, m_FoundPositions);
@@ -174,5 +217,69 @@ TEST_F(TestGridSolverWithoutHypothesis, GridSolvedAfterSecondUpdateGrid)
     EXPECT_TRUE(m_FoundPositions.empty());
 }
 
+TEST_F(TestGridSolverWithoutHypothesis, CouldntResolveIfRemovePossibilitiesFail)
+{
+    Grid grid = Create4x4CorrectlyPartiallyFilledGrid();
+    m_FoundPositions.push(Position {0, 0});
+
+    {
+    InSequence s;
+    ExpectUpdateGrid(grid);
+    ExpectSetCellsWithUniquePossibility_NoCellFound(grid);
+    EXPECT_CALL(*m_PatternPossibilitiesRemover, RemovePossibilities(Ref(grid), _, _))
+            .WillOnce(Invoke([](Grid&, FoundPositions& foundPositions, bool&)
+                {
+                    foundPositions.push(Position {2, 3});
+                    return false;
+                }));
+    }
+
+    auto gridStatus = MakeGridSolverWithoutHypothesis()->Solve(grid, m_FoundPositions);
+
+    EXPECT_THAT(gridStatus, Eq(GridStatus::Wrong));
+    EXPECT_TRUE(m_FoundPositions.empty());
+}
+
+TEST_F(TestGridSolverWithoutHypothesis, GridSolvedAfterRemovePossibilities)
+{
+    Grid grid = Create4x4CorrectlyPartiallyFilledGrid();
+    m_FoundPositions.push(Position {0, 0});
+
+    {
+    InSequence s;
+    ExpectUpdateGrid(grid);
+    ExpectSetCellsWithUniquePossibility_NoCellFound(grid);
+    ExpectRemovePossibilities_FoundPositions(grid, Position {2, 3});
+    ExpectSetCellsWithUniquePossibility_NoCellFound(grid);
+    ExpectUpdateGrid_SolveGrid(grid);
+    ExpectSetCellsWithUniquePossibility_NoCellFound(grid);
+    }
+
+    auto gridStatus = MakeGridSolverWithoutHypothesis()->Solve(grid, m_FoundPositions);
+
+    EXPECT_THAT(gridStatus, Eq(GridStatus::SolvedCorrectly));
+    EXPECT_TRUE(m_FoundPositions.empty());
+}
+
+TEST_F(TestGridSolverWithoutHypothesis, RemovePossibilitiesRepeatedUntilNothingRemoved)
+{
+    Grid grid = Create4x4CorrectlyPartiallyFilledGrid();
+    m_FoundPositions.push(Position {0, 0});
+
+    {
+    InSequence s;
+    ExpectUpdateGrid(grid);
+    ExpectSetCellsWithUniquePossibility_NoCellFound(grid);
+    ExpectRemovePossibilities_NoCellFound(grid);
+    ExpectSetCellsWithUniquePossibility_NoCellFound(grid);
+    ExpectRemovePossibilities_NothingRemoved(grid);
+    }
+
+    auto gridStatus = MakeGridSolverWithoutHypothesis()->Solve(grid, m_FoundPositions);
+
+    EXPECT_THAT(gridStatus, Eq(GridStatus::Incomplete));
+    EXPECT_TRUE(m_FoundPositions.empty());
+}
+
 } /* namespace test */
 } /* namespace sudoku */
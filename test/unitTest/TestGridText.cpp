@@ -0,0 +1,88 @@
+#include "GridText.hpp"
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <stdexcept>
+
+#include "utils/Utils.hpp"
+
+using testing::Eq;
+
+namespace sudoku
+{
+namespace test
+{
+
+class TestGridText : public ::testing::Test
+{
+public:
+    TestGridText()
+    {}
+};
+
+TEST_F(TestGridText, ParseGrid9x9)
+{
+    const std::string line {"8..........36......7..9.2...5...7.......457.....1...3...1....68..85...1..9....4.."};
+
+    EXPECT_THAT(ParseGrid(line), Eq(CreateGrid(9, ParsePositionsValues(line))));
+}
+
+TEST_F(TestGridText, ParseGridWithZerosForEmptyCells)
+{
+    EXPECT_THAT(ParseGrid("1002003004000000"), Eq(ParseGrid("1..2..3..4......")));
+}
+
+TEST_F(TestGridText, ParseGrid16x16WithLetters)
+{
+    std::string line(256, '.');
+    line[0] = 'G';
+    line[17] = 'A';
+
+    const auto grid = ParseGrid(line);
+
+    EXPECT_THAT(grid.GetCell(Position {0, 0}).GetValue(), Eq(16));
+    EXPECT_THAT(grid.GetCell(Position {1, 1}).GetValue(), Eq(10));
+    EXPECT_THAT(grid.GetUnsetCellsCount(), Eq(254));
+}
+
+TEST_F(TestGridText, ParseGridWithWrongLengthThrows)
+{
+    EXPECT_THROW(ParseGrid(""), std::runtime_error);
+    EXPECT_THROW(ParseGrid(std::string(80, '.')), std::runtime_error);
+    EXPECT_THROW(ParseGrid(std::string(49, '.')), std::runtime_error) << "7x7 grids aren't supported";
+}
+
+TEST_F(TestGridText, ParseGridWithUnexpectedCharacterThrows)
+{
+    EXPECT_THROW(ParseGrid("1..2..3..4.....x"), std::runtime_error);
+    EXPECT_THROW(ParseGrid("1..2..3..4.....5"), std::runtime_error) << "Value too large for the grid";
+}
+
+TEST_F(TestGridText, FormatGridIsParsedBack)
+{
+    for (int gridSize : {4, 9, 16, 25})
+    {
+        const auto grid = CreateGrid(gridSize, KeepRandomCells(CreateSolvedPositionsValues(gridSize), gridSize * 2));
+
+        EXPECT_THAT(ParseGrid(FormatGrid(grid)), Eq(grid));
+    }
+}
+
+TEST_F(TestGridText, FormatGrid)
+{
+    EXPECT_THAT(FormatGrid(Create4x4CorrectlySolvedGrid()), Eq("1234341223414123"));
+}
+
+TEST_F(TestGridText, FormatGridIntoBuffer)
+{
+    std::string line(MaxGridLineLength + 1, '#');
+
+    FormatGrid(CreateGrid(25, {{Position{0, 0}, 25}, {Position{0, 2}, 10}}), line.data());
+
+    EXPECT_THAT(line.substr(0, 4), Eq("P.A."));
+    EXPECT_THAT(line.back(), Eq('#')) << "Written past the cells of the grid";
+}
+
+} /* namespace test */
+} /* namespace sudoku */
@@ -0,0 +1,62 @@
+#include "MappedFile.hpp"
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <cstdio>
+#include <fstream>
+#include <stdexcept>
+
+using testing::Eq;
+
+namespace sudoku
+{
+namespace test
+{
+
+class TestMappedFile : public ::testing::Test
+{
+public:
+    TestMappedFile()
+    {}
+
+    ~TestMappedFile()
+    {
+        std::remove(m_FileName.c_str());
+    }
+
+    void WriteFile(std::string const& content)
+    {
+        std::ofstream file {m_FileName, std::ios::binary};
+        file << content;
+    }
+
+    const std::string m_FileName {"TestMappedFile.txt"};
+};
+
+TEST_F(TestMappedFile, ContentOfFile)
+{
+    const std::string content {"1...............\n2...............\n"};
+    WriteFile(content);
+
+    MappedFile mappedFile {m_FileName};
+
+    EXPECT_THAT(mappedFile.GetContent(), Eq(content));
+}
+
+TEST_F(TestMappedFile, EmptyFile)
+{
+    WriteFile("");
+
+    MappedFile mappedFile {m_FileName};
+
+    EXPECT_TRUE(mappedFile.GetContent().empty());
+}
+
+TEST_F(TestMappedFile, MissingFileThrows)
+{
+    EXPECT_THROW(MappedFile {"MissingFile.txt"}, std::runtime_error);
+}
+
+} /* namespace test */
+} /* namespace sudoku */
@@ -0,0 +1,152 @@
+#include "ParallelBatchGridSolver.hpp"
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <mutex>
+#include <set>
+#include <stdexcept>
+#include <thread>
+
+
+using testing::Eq;
+using testing::Le;
+
+namespace sudoku
+{
+namespace test
+{
+
+// Grids with a value in their first cell are solved, a value above the grid size throws.
+// Remembers the threads it was called from.
+class FakeBatchGridSolver final : public BatchGridSolver
+{
+public:
+    std::vector<bool> Solve(int gridSize, std::uint8_t* values, std::size_t count) const override
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            m_ThreadIds.insert(std::this_thread::get_id());
+        }
+
+        std::vector<bool> solved;
+
+        for (std::size_t i = 0; i < count; i++)
+        {
+            if (values[i * gridSize * gridSize] > gridSize)
+                throw std::runtime_error("Wrong value");
+
+            solved.push_back(values[i * gridSize * gridSize] != 0);
+        }
+
+        return solved;
+    }
+
+    std::set<std::thread::id> GetThreadIds() const
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        return m_ThreadIds;
+    }
+
+private:
+    mutable std::mutex m_Mutex;
+    mutable std::set<std::thread::id> m_ThreadIds;
+};
+
+class TestParallelBatchGridSolver : public ::testing::Test
+{
+public:
+    TestParallelBatchGridSolver()
+    {}
+
+    std::unique_ptr<BatchGridSolver> MakeParallelBatchGridSolver()
+    {
+        auto threadPool = std::make_shared<ThreadPool>(m_ThreadsCount);
+
+        std::vector<std::unique_ptr<BatchGridSolver>> batchGridSolvers;
+
+        for (int i = 0; i <= m_ThreadsCount; i++)
+        {
+            auto batchGridSolver = std::make_unique<FakeBatchGridSolver>();
+            m_BatchGridSolvers.push_back(batchGridSolver.get());
+            batchGridSolvers.push_back(std::move(batchGridSolver));
+        }
+
+        return std::make_unique<ParallelBatchGridSolverImpl>(std::move(batchGridSolvers), std::move(threadPool));
+    }
+
+    const int m_ThreadsCount {3};
+
+    std::vector<FakeBatchGridSolver const*> m_BatchGridSolvers;
+};
+
+TEST_F(TestParallelBatchGridSolver, ResultOfEachGridReturnedInOrder)
+{
+    auto parallelBatchGridSolver = MakeParallelBatchGridSolver();
+
+    std::vector<std::uint8_t> values(1'000 * 16, 0);
+    std::vector<bool> expectedSolved;
+
+    for (int i = 0; i < 1'000; i++)
+    {
+        if (i % 3 == 0)
+            values[i * 16] = 1;
+
+        expectedSolved.push_back(i % 3 == 0);
+    }
+
+    EXPECT_THAT(parallelBatchGridSolver->Solve(4, values.data(), 1'000), Eq(expectedSolved));
+}
+
+TEST_F(TestParallelBatchGridSolver, EachBatchGridSolverUsedBySingleThread)
+{
+    auto parallelBatchGridSolver = MakeParallelBatchGridSolver();
+
+    std::vector<std::uint8_t> values(1'000 * 16, 0);
+
+    parallelBatchGridSolver->Solve(4, values.data(), 1'000);
+    parallelBatchGridSolver->Solve(4, values.data(), 1'000);
+
+    for (auto batchGridSolver : m_BatchGridSolvers)
+        EXPECT_THAT(batchGridSolver->GetThreadIds().size(), Le(1u));
+}
+
+TEST_F(TestParallelBatchGridSolver, BatchGridSolverExceptionRethrownAfterAllTasks)
+{
+    auto parallelBatchGridSolver = MakeParallelBatchGridSolver();
+
+    std::vector<std::uint8_t> values(1'000 * 16, 0);
+    values[500 * 16] = 5;
+
+    EXPECT_THROW(parallelBatchGridSolver->Solve(4, values.data(), 1'000), std::runtime_error);
+
+    // The pool is still usable
+    values[500 * 16] = 1;
+
+    EXPECT_THAT(parallelBatchGridSolver->Solve(4, values.data(), 1'000)[500], Eq(true));
+}
+
+TEST_F(TestParallelBatchGridSolver, NoGridToSolve)
+{
+    EXPECT_TRUE(MakeParallelBatchGridSolver()->Solve(9, nullptr, 0).empty());
+}
+
+TEST_F(TestParallelBatchGridSolver, UnsupportedGridSizeThrows)
+{
+    std::vector<std::uint8_t> values(49, 0);
+
+    EXPECT_THROW(MakeParallelBatchGridSolver()->Solve(7, values.data(), 1), std::runtime_error);
+}
+
+TEST_F(TestParallelBatchGridSolver, BatchGridSolverMissingForCallingThreadThrows)
+{
+    std::vector<std::unique_ptr<BatchGridSolver>> batchGridSolvers;
+
+    for (int i = 0; i < m_ThreadsCount; i++)
+        batchGridSolvers.push_back(std::make_unique<FakeBatchGridSolver>());
+
+    EXPECT_THROW(ParallelBatchGridSolverImpl(std::move(batchGridSolvers), std::make_shared<ThreadPool>(m_ThreadsCount)), std::runtime_error);
+}
+
+} /* namespace test */
+} /* namespace sudoku */
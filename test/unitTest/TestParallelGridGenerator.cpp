@@ -0,0 +1,134 @@
+#include "ParallelGridGenerator.hpp"
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <mutex>
+#include <set>
+#include <stdexcept>
+#include <thread>
+
+#include "Grid.hpp"
+
+using testing::Eq;
+using testing::Le;
+
+namespace sudoku
+{
+namespace test
+{
+
+// The cell of index seed % 81 is set in the grid generated from a seed, the seeds multiple of 5 are left out.
+// The seed ThrowingSeed throws. Remembers the threads it was called from.
+class FakeGridGenerator final : public GridGenerator
+{
+public:
+    static constexpr std::uint64_t ThrowingSeed {1'000'003};
+
+    std::vector<Grid> Generate(int gridsCount, std::uint64_t seed) const override
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            m_ThreadIds.insert(std::this_thread::get_id());
+        }
+
+        std::vector<Grid> grids;
+
+        for (int i = 0; i < gridsCount; i++)
+        {
+            if (seed + i == ThrowingSeed)
+                throw std::runtime_error("Generation failed");
+
+            if ((seed + i) % 5 == 0)
+                continue;
+
+            grids.emplace_back(9);
+            grids.back().SetValue((seed + i) % 81, 1);
+        }
+
+        return grids;
+    }
+
+    std::set<std::thread::id> GetThreadIds() const
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        return m_ThreadIds;
+    }
+
+private:
+    mutable std::mutex m_Mutex;
+    mutable std::set<std::thread::id> m_ThreadIds;
+};
+
+class TestParallelGridGenerator : public ::testing::Test
+{
+public:
+    TestParallelGridGenerator()
+    {}
+
+    std::unique_ptr<GridGenerator> MakeParallelGridGenerator()
+    {
+        auto threadPool = std::make_shared<ThreadPool>(m_ThreadsCount);
+
+        std::vector<std::unique_ptr<GridGenerator>> gridGenerators;
+
+        for (int i = 0; i <= m_ThreadsCount; i++)
+        {
+            auto gridGenerator = std::make_unique<FakeGridGenerator>();
+            m_GridGenerators.push_back(gridGenerator.get());
+            gridGenerators.push_back(std::move(gridGenerator));
+        }
+
+        return std::make_unique<ParallelGridGeneratorImpl>(std::move(gridGenerators), std::move(threadPool));
+    }
+
+    const int m_ThreadsCount {3};
+
+    std::vector<FakeGridGenerator const*> m_GridGenerators;
+};
+
+TEST_F(TestParallelGridGenerator, GridsOfSingleGeneratorReturnedInOrder)
+{
+    const auto grids = MakeParallelGridGenerator()->Generate(1'000, 7);
+
+    EXPECT_THAT(grids, Eq(FakeGridGenerator{}.Generate(1'000, 7)));
+}
+
+TEST_F(TestParallelGridGenerator, EachGridGeneratorUsedBySingleThread)
+{
+    auto parallelGridGenerator = MakeParallelGridGenerator();
+
+    parallelGridGenerator->Generate(1'000, 0);
+    parallelGridGenerator->Generate(1'000, 0);
+
+    for (auto gridGenerator : m_GridGenerators)
+        EXPECT_THAT(gridGenerator->GetThreadIds().size(), Le(1u));
+}
+
+TEST_F(TestParallelGridGenerator, GridGeneratorExceptionRethrownAfterAllTasks)
+{
+    auto parallelGridGenerator = MakeParallelGridGenerator();
+
+    EXPECT_THROW(parallelGridGenerator->Generate(1'000, FakeGridGenerator::ThrowingSeed - 500), std::runtime_error);
+
+    // The pool is still usable
+    EXPECT_THAT(parallelGridGenerator->Generate(1'000, 7), Eq(FakeGridGenerator{}.Generate(1'000, 7)));
+}
+
+TEST_F(TestParallelGridGenerator, NoGridToGenerate)
+{
+    EXPECT_TRUE(MakeParallelGridGenerator()->Generate(0, 0).empty());
+}
+
+TEST_F(TestParallelGridGenerator, GridGeneratorMissingForCallingThreadThrows)
+{
+    std::vector<std::unique_ptr<GridGenerator>> gridGenerators;
+
+    for (int i = 0; i < m_ThreadsCount; i++)
+        gridGenerators.push_back(std::make_unique<FakeGridGenerator>());
+
+    EXPECT_THROW(ParallelGridGeneratorImpl(std::move(gridGenerators), std::make_shared<ThreadPool>(m_ThreadsCount)), std::runtime_error);
+}
+
+} /* namespace test */
+} /* namespace sudoku */
@@ -0,0 +1,163 @@
+#include "ParallelGridSolverWithHypothesis.hpp"
+
+#include <stdexcept>
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include "FoundPositions.hpp"
+#include "GridStatus.hpp"
+#include "Grid.hpp"
+
+#include "mock/MockGridSolverWithoutHypothesis.hpp"
+
+using testing::_;
+using testing::Eq;
+using testing::Return;
+using testing::UnorderedElementsAre;
+using testing::StrictMock;
+
+namespace sudoku
+{
+namespace test
+{
+
+class TestParallelGridSolverWithHypothesis : public ::testing::Test
+{
+public:
+    TestParallelGridSolverWithHypothesis()
+    {
+        m_Grid.GetCell(Position {0, 1}).SetValue(4);
+        m_Grid.GetCell(Position {3, 2}).SetValue(2);
+        m_Grid.GetCell(Position {1, 0}).RemovePossibility(3);
+        m_Grid.GetCell(m_HypothesisCellPosition).RemovePossibility(4);
+        m_Grid.GetCell(m_HypothesisCellPosition).RemovePossibility(3);
+
+        m_HypothesisGrid1 = m_Grid;
+        m_HypothesisGrid1.GetCell(m_HypothesisCellPosition).SetValue(2);
+
+        m_HypothesisGrid2 = m_Grid;
+        m_HypothesisGrid2.GetCell(m_HypothesisCellPosition).SetValue(1);
+    }
+
+    std::unique_ptr<ParallelGridSolverWithHypothesisImpl<>> MakeParallelGridSolverWithHypothesis(int splitDepth)
+    {
+        ParallelSearch parallelSearch;
+        parallelSearch.m_SplitDepth = splitDepth;
+        parallelSearch.m_SplitMinUnsetCells = 0;
+
+        return std::make_unique<ParallelGridSolverWithHypothesisImpl<>>(
+                    std::move(m_GridSolverWithoutHypothesis),
+                    std::make_unique<FewestPossibilitiesBranchingImpl>(),
+                    std::make_shared<ThreadPool>(2),
+                    parallelSearch);
+    }
+
+    std::unique_ptr<MockGridSolverWithoutHypothesis> m_GridSolverWithoutHypothesis = std::make_unique<StrictMock<MockGridSolverWithoutHypothesis>>();
+
+    const Position m_HypothesisCellPosition {1, 2};
+
+    Grid m_Grid {4};
+    Grid m_HypothesisGrid1 {4};
+    Grid m_HypothesisGrid2 {4};
+};
+
+TEST_F(TestParallelGridSolverWithHypothesis, GridSolvedWithoutHypthesis)
+{
+    EXPECT_CALL(*m_GridSolverWithoutHypothesis, Solve(Eq(m_Grid), _)).WillOnce(Return(GridStatus::SolvedCorrectly));
+
+    EXPECT_TRUE(MakeParallelGridSolverWithHypothesis(4)->Solve(m_Grid));
+}
+
+TEST_F(TestParallelGridSolverWithHypothesis, GridSolvedByHypothesisGivenToOtherTask)
+{
+    EXPECT_CALL(*m_GridSolverWithoutHypothesis, Solve(Eq(m_Grid), _)).WillOnce(Return(GridStatus::Incomplete));
+    EXPECT_CALL(*m_GridSolverWithoutHypothesis, Solve(Eq(m_HypothesisGrid1), _)).WillOnce(Return(GridStatus::SolvedCorrectly));
+    EXPECT_CALL(*m_GridSolverWithoutHypothesis, Solve(Eq(m_HypothesisGrid2), _)).Times(testing::AtMost(1)).WillOnce(Return(GridStatus::Wrong));
+
+    auto correctlySolved = MakeParallelGridSolverWithHypothesis(4)->Solve(m_Grid);
+
+    EXPECT_TRUE(correctlySolved);
+    EXPECT_THAT(m_Grid, Eq(m_HypothesisGrid1));
+}
+
+TEST_F(TestParallelGridSolverWithHypothesis, GridSolvedWrongAfterAllHypotheses)
+{
+    EXPECT_CALL(*m_GridSolverWithoutHypothesis, Solve(Eq(m_Grid), _)).WillOnce(Return(GridStatus::Incomplete));
+    EXPECT_CALL(*m_GridSolverWithoutHypothesis, Solve(Eq(m_HypothesisGrid1), _)).WillOnce(Return(GridStatus::Wrong));
+    EXPECT_CALL(*m_GridSolverWithoutHypothesis, Solve(Eq(m_HypothesisGrid2), _)).WillOnce(Return(GridStatus::Wrong));
+
+    EXPECT_FALSE(MakeParallelGridSolverWithHypothesis(4)->Solve(m_Grid));
+}
+
+TEST_F(TestParallelGridSolverWithHypothesis, GridSolvedSequentiallyFromSplitDepth)
+{
+    {
+    testing::InSequence s;
+    EXPECT_CALL(*m_GridSolverWithoutHypothesis, Solve(Eq(m_Grid), _)).WillOnce(Return(GridStatus::Incomplete));
+    EXPECT_CALL(*m_GridSolverWithoutHypothesis, Solve(Eq(m_HypothesisGrid1), _)).WillOnce(Return(GridStatus::Wrong));
+    EXPECT_CALL(*m_GridSolverWithoutHypothesis, Solve(Eq(m_HypothesisGrid2), _)).WillOnce(Return(GridStatus::SolvedCorrectly));
+    }
+
+    auto correctlySolved = MakeParallelGridSolverWithHypothesis(0)->Solve(m_Grid);
+
+    EXPECT_TRUE(correctlySolved);
+    EXPECT_THAT(m_Grid, Eq(m_HypothesisGrid2));
+}
+
+TEST_F(TestParallelGridSolverWithHypothesis, SolutionsOfAllSubtreesEnumerated)
+{
+    EXPECT_CALL(*m_GridSolverWithoutHypothesis, Solve(Eq(m_Grid), _)).WillOnce(Return(GridStatus::Incomplete));
+    EXPECT_CALL(*m_GridSolverWithoutHypothesis, Solve(Eq(m_HypothesisGrid1), _)).WillOnce(Return(GridStatus::SolvedCorrectly));
+    EXPECT_CALL(*m_GridSolverWithoutHypothesis, Solve(Eq(m_HypothesisGrid2), _)).WillOnce(Return(GridStatus::SolvedCorrectly));
+
+    std::vector<Grid> solutions;
+
+    const auto solutionsCount = MakeParallelGridSolverWithHypothesis(4)->EnumerateSolutions(m_Grid, [&solutions](Grid const& solution)
+        {
+            solutions.push_back(solution);
+            return true;
+        });
+
+    EXPECT_THAT(solutionsCount, Eq(2));
+    EXPECT_THAT(solutions, UnorderedElementsAre(m_HypothesisGrid1, m_HypothesisGrid2));
+}
+
+TEST_F(TestParallelGridSolverWithHypothesis, EnumerationStoppedByVisitor)
+{
+    {
+    testing::InSequence s;
+    EXPECT_CALL(*m_GridSolverWithoutHypothesis, Solve(Eq(m_Grid), _)).WillOnce(Return(GridStatus::Incomplete));
+    EXPECT_CALL(*m_GridSolverWithoutHypothesis, Solve(Eq(m_HypothesisGrid1), _)).WillOnce(Return(GridStatus::SolvedCorrectly));
+    }
+
+    const auto solutionsCount = MakeParallelGridSolverWithHypothesis(0)->EnumerateSolutions(m_Grid, [](Grid const&){ return false; });
+
+    EXPECT_THAT(solutionsCount, Eq(1));
+}
+
+TEST_F(TestParallelGridSolverWithHypothesis, VisitorExceptionRethrownAfterAllTasks)
+{
+    EXPECT_CALL(*m_GridSolverWithoutHypothesis, Solve(Eq(m_Grid), _)).WillOnce(Return(GridStatus::Incomplete));
+    // The first hypothesis solved, on either thread, throws and stops the search
+    EXPECT_CALL(*m_GridSolverWithoutHypothesis, Solve(Eq(m_HypothesisGrid1), _)).Times(testing::AtMost(1)).WillOnce(Return(GridStatus::SolvedCorrectly));
+    EXPECT_CALL(*m_GridSolverWithoutHypothesis, Solve(Eq(m_HypothesisGrid2), _)).Times(testing::AtMost(1)).WillOnce(Return(GridStatus::SolvedCorrectly));
+
+    auto parallelGridSolverWithHypothesis = MakeParallelGridSolverWithHypothesis(4);
+
+    EXPECT_THROW(parallelGridSolverWithHypothesis->EnumerateSolutions(m_Grid, [](Grid const&) -> bool { throw std::runtime_error("visitor"); }),
+                 std::runtime_error);
+}
+
+TEST_F(TestParallelGridSolverWithHypothesis, SolutionsCountStoppedAtLimit)
+{
+    EXPECT_CALL(*m_GridSolverWithoutHypothesis, Solve(Eq(m_Grid), _)).WillOnce(Return(GridStatus::Incomplete));
+    // The first hypothesis solved, on either thread, stops the search
+    EXPECT_CALL(*m_GridSolverWithoutHypothesis, Solve(Eq(m_HypothesisGrid1), _)).Times(testing::AtMost(1)).WillOnce(Return(GridStatus::SolvedCorrectly));
+    EXPECT_CALL(*m_GridSolverWithoutHypothesis, Solve(Eq(m_HypothesisGrid2), _)).Times(testing::AtMost(1)).WillOnce(Return(GridStatus::SolvedCorrectly));
+
+    EXPECT_THAT(MakeParallelGridSolverWithHypothesis(4)->CountSolutions(m_Grid, 1), Eq(1));
+}
+
+} /* namespace test */
+} /* namespace sudoku */
@@ -0,0 +1,252 @@
+#include "PatternPossibilitiesRemover.hpp"
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include "Grid.hpp"
+#include "utils/Utils.hpp"
+
+using testing::Eq;
+
+namespace sudoku
+{
+namespace test
+{
+
+class TestPatternPossibilitiesRemover : public ::testing::Test
+{
+public:
+    TestPatternPossibilitiesRemover()
+    {}
+
+    void RemovePossibilityFromBlockRows(Grid& grid, int firstRow, int lastRow, int firstCol, Value possibility)
+    {
+        for (int row = firstRow; row <= lastRow; row++)
+        {
+            for (int col = firstCol; col < firstCol + 3; col++)
+                grid.GetCell(Position{row, col}).RemovePossibility(possibility);
+        }
+    }
+
+    const Deductions LockedCandidates {{Deduction::LockedCandidates}};
+    const Deductions NakedSubsets {{Deduction::NakedSubsets}};
+    const Deductions HiddenSubsets {{Deduction::HiddenSubsets}};
+    const Deductions AllDeductions {{Deduction::LockedCandidates, Deduction::NakedSubsets, Deduction::HiddenSubsets}};
+
+    FoundPositions m_FoundPositions;
+    bool m_PossibilitiesRemoved {false};
+};
+
+TEST_F(TestPatternPossibilitiesRemover, NothingRemovedFromEmptyGrid)
+{
+    Grid grid {9};
+
+    EXPECT_TRUE(PatternPossibilitiesRemoverImpl<9>(AllDeductions).RemovePossibilities(grid, m_FoundPositions, m_PossibilitiesRemoved));
+
+    EXPECT_FALSE(m_PossibilitiesRemoved);
+    EXPECT_TRUE(m_FoundPositions.empty());
+    EXPECT_THAT(grid, Eq(Grid {9}));
+}
+
+TEST_F(TestPatternPossibilitiesRemover, ValueConfinedToRowOfBlockRemovedFromRestOfRow)
+{
+    Grid grid {9};
+    RemovePossibilityFromBlockRows(grid, 1, 2, 0, 5);
+
+    auto expectedGrid = grid;
+    for (int col = 3; col < 9; col++)
+        expectedGrid.GetCell(Position{0, col}).RemovePossibility(5);
+
+    EXPECT_TRUE(PatternPossibilitiesRemoverImpl<9>(LockedCandidates).RemovePossibilities(grid, m_FoundPositions, m_PossibilitiesRemoved));
+
+    EXPECT_TRUE(m_PossibilitiesRemoved);
+    EXPECT_THAT(grid, Eq(expectedGrid));
+}
+
+TEST_F(TestPatternPossibilitiesRemover, ValueConfinedToColumnOfBlockRemovedFromRestOfColumn)
+{
+    Grid grid {4};
+
+    grid.GetCell(Position{0, 1}).RemovePossibility(3);
+    grid.GetCell(Position{1, 1}).RemovePossibility(3);
+
+    auto expectedGrid = grid;
+    expectedGrid.GetCell(Position{2, 0}).RemovePossibility(3);
+    expectedGrid.GetCell(Position{3, 0}).RemovePossibility(3);
+
+    EXPECT_TRUE(PatternPossibilitiesRemoverImpl<4>(LockedCandidates).RemovePossibilities(grid, m_FoundPositions, m_PossibilitiesRemoved));
+
+    EXPECT_TRUE(m_PossibilitiesRemoved);
+    EXPECT_THAT(grid, Eq(expectedGrid));
+}
+
+TEST_F(TestPatternPossibilitiesRemover, ValueOfRowConfinedToBlockRemovedFromRestOfBlock)
+{
+    Grid grid {9};
+
+    for (int col = 3; col < 9; col++)
+        grid.GetCell(Position{0, col}).RemovePossibility(5);
+
+    auto expectedGrid = grid;
+    RemovePossibilityFromBlockRows(expectedGrid, 1, 2, 0, 5);
+
+    EXPECT_TRUE(PatternPossibilitiesRemoverImpl<9>(LockedCandidates).RemovePossibilities(grid, m_FoundPositions, m_PossibilitiesRemoved));
+
+    EXPECT_TRUE(m_PossibilitiesRemoved);
+    EXPECT_THAT(grid, Eq(expectedGrid));
+}
+
+TEST_F(TestPatternPossibilitiesRemover, NakedPairRemovedFromRestOfItsUnits)
+{
+    Grid grid {9};
+
+    RemoveAllCellPossibilitiesBut(grid.GetCell(Position{0, 0}), {1, 2});
+    RemoveAllCellPossibilitiesBut(grid.GetCell(Position{0, 1}), {1, 2});
+
+    auto expectedGrid = grid;
+    for (int col = 2; col < 9; col++)
+    {
+        expectedGrid.GetCell(Position{0, col}).RemovePossibility(1);
+        expectedGrid.GetCell(Position{0, col}).RemovePossibility(2);
+    }
+    RemovePossibilityFromBlockRows(expectedGrid, 1, 2, 0, 1);
+    RemovePossibilityFromBlockRows(expectedGrid, 1, 2, 0, 2);
+
+    EXPECT_TRUE(PatternPossibilitiesRemoverImpl<9>(NakedSubsets).RemovePossibilities(grid, m_FoundPositions, m_PossibilitiesRemoved));
+
+    EXPECT_TRUE(m_PossibilitiesRemoved);
+    EXPECT_TRUE(m_FoundPositions.empty());
+    EXPECT_THAT(grid, Eq(expectedGrid));
+}
+
+TEST_F(TestPatternPossibilitiesRemover, CellLeftWithSinglePossibilityFound)
+{
+    Grid grid {9};
+
+    RemoveAllCellPossibilitiesBut(grid.GetCell(Position{0, 0}), {1, 2});
+    RemoveAllCellPossibilitiesBut(grid.GetCell(Position{0, 1}), {1, 2});
+    RemoveAllCellPossibilitiesBut(grid.GetCell(Position{0, 5}), {1, 2, 7});
+
+    EXPECT_TRUE(PatternPossibilitiesRemoverImpl<9>(NakedSubsets).RemovePossibilities(grid, m_FoundPositions, m_PossibilitiesRemoved));
+
+    EXPECT_THAT(QueueToVector(m_FoundPositions), Eq(std::vector<Position>{Position{0, 5}}));
+    EXPECT_THAT(grid.GetCell(Position{0, 5}).GetValue(), Eq(7));
+}
+
+TEST_F(TestPatternPossibilitiesRemover, ThreeCellsWithTwoValuesLeftIsWrong)
+{
+    Grid grid {9};
+
+    for (int col = 0; col < 3; col++)
+        RemoveAllCellPossibilitiesBut(grid.GetCell(Position{4, col}), {3, 8});
+
+    EXPECT_FALSE(PatternPossibilitiesRemoverImpl<9>(NakedSubsets).RemovePossibilities(grid, m_FoundPositions, m_PossibilitiesRemoved));
+}
+
+TEST_F(TestPatternPossibilitiesRemover, HiddenPairKeepsOnlyItsValues)
+{
+    Grid grid {9};
+
+    for (int col = 2; col < 9; col++)
+    {
+        grid.GetCell(Position{4, col}).RemovePossibility(1);
+        grid.GetCell(Position{4, col}).RemovePossibility(2);
+    }
+
+    auto expectedGrid = grid;
+    RemoveAllCellPossibilitiesBut(expectedGrid.GetCell(Position{4, 0}), {1, 2});
+    RemoveAllCellPossibilitiesBut(expectedGrid.GetCell(Position{4, 1}), {1, 2});
+
+    EXPECT_TRUE(PatternPossibilitiesRemoverImpl<9>(HiddenSubsets).RemovePossibilities(grid, m_FoundPositions, m_PossibilitiesRemoved));
+
+    EXPECT_TRUE(m_PossibilitiesRemoved);
+    EXPECT_THAT(grid, Eq(expectedGrid));
+}
+
+TEST_F(TestPatternPossibilitiesRemover, DeductionsNotListedNotMade)
+{
+    Grid grid {9};
+
+    RemoveAllCellPossibilitiesBut(grid.GetCell(Position{0, 0}), {1, 2});
+    RemoveAllCellPossibilitiesBut(grid.GetCell(Position{0, 1}), {1, 2});
+
+    const auto expectedGrid = grid;
+
+    EXPECT_TRUE(PatternPossibilitiesRemoverImpl<9>(HiddenSubsets).RemovePossibilities(grid, m_FoundPositions, m_PossibilitiesRemoved));
+
+    EXPECT_FALSE(m_PossibilitiesRemoved);
+    EXPECT_THAT(grid, Eq(expectedGrid));
+}
+
+TEST_F(TestPatternPossibilitiesRemover, OnlyFirstDeductionRemovingPossibilitiesMade)
+{
+    Grid grid {9};
+
+    RemovePossibilityFromBlockRows(grid, 1, 2, 0, 5);
+    RemoveAllCellPossibilitiesBut(grid.GetCell(Position{8, 0}), {3, 4});
+    RemoveAllCellPossibilitiesBut(grid.GetCell(Position{8, 1}), {3, 4});
+
+    auto expectedGrid = grid;
+    for (int col = 3; col < 9; col++)
+        expectedGrid.GetCell(Position{0, col}).RemovePossibility(5);
+
+    EXPECT_TRUE(PatternPossibilitiesRemoverImpl<9>(AllDeductions).RemovePossibilities(grid, m_FoundPositions, m_PossibilitiesRemoved));
+
+    EXPECT_TRUE(m_PossibilitiesRemoved);
+    EXPECT_THAT(grid, Eq(expectedGrid));
+}
+
+TEST_F(TestPatternPossibilitiesRemover, DeductionsTriedInTheirOrder)
+{
+    Grid grid {9};
+
+    RemovePossibilityFromBlockRows(grid, 1, 2, 0, 5);
+    RemoveAllCellPossibilitiesBut(grid.GetCell(Position{8, 0}), {3, 4});
+    RemoveAllCellPossibilitiesBut(grid.GetCell(Position{8, 1}), {3, 4});
+
+    auto expectedGrid = grid;
+    for (int col = 2; col < 9; col++)
+    {
+        expectedGrid.GetCell(Position{8, col}).RemovePossibility(3);
+        expectedGrid.GetCell(Position{8, col}).RemovePossibility(4);
+    }
+    RemovePossibilityFromBlockRows(expectedGrid, 6, 7, 0, 3);
+    RemovePossibilityFromBlockRows(expectedGrid, 6, 7, 0, 4);
+
+    const Deductions deductions {{Deduction::NakedSubsets, Deduction::LockedCandidates}};
+
+    EXPECT_TRUE(PatternPossibilitiesRemoverImpl<9>(deductions).RemovePossibilities(grid, m_FoundPositions, m_PossibilitiesRemoved));
+
+    EXPECT_TRUE(m_PossibilitiesRemoved);
+    EXPECT_THAT(grid, Eq(expectedGrid));
+}
+
+TEST_F(TestPatternPossibilitiesRemover, EachDeductionTriedIsProfiled)
+{
+    Grid grid {9};
+
+    RemoveAllCellPossibilitiesBut(grid.GetCell(Position{0, 0}), {1, 2});
+    RemoveAllCellPossibilitiesBut(grid.GetCell(Position{0, 1}), {1, 2});
+
+    DeductionsProfile profile;
+    Deductions deductions {AllDeductions};
+    deductions.m_Profile = &profile;
+
+    EXPECT_TRUE(PatternPossibilitiesRemoverImpl<9>(deductions).RemovePossibilities(grid, m_FoundPositions, m_PossibilitiesRemoved));
+
+    auto const& lockedCandidates = profile[static_cast<int>(Deduction::LockedCandidates)];
+    EXPECT_THAT(lockedCandidates.m_Tries, Eq(1u));
+    EXPECT_THAT(lockedCandidates.m_Hits, Eq(0u));
+    EXPECT_THAT(lockedCandidates.m_PossibilitiesRemoved, Eq(0u));
+
+    // Removed from the 7 other cells of the row and the 6 other cells of the block
+    auto const& nakedSubsets = profile[static_cast<int>(Deduction::NakedSubsets)];
+    EXPECT_THAT(nakedSubsets.m_Tries, Eq(1u));
+    EXPECT_THAT(nakedSubsets.m_Hits, Eq(1u));
+    EXPECT_THAT(nakedSubsets.m_PossibilitiesRemoved, Eq(2u * (7 + 6)));
+
+    EXPECT_THAT(profile[static_cast<int>(Deduction::HiddenSubsets)].m_Tries, Eq(0u));
+}
+
+} /* namespace test */
+} /* namespace sudoku */
@@ -23,6 +23,13 @@ TEST_F(TestPossibilities, AllPossibilitiesSetAtConstruction)
     EXPECT_THAT(Possibilities {4}, Eq(PossibilitiesBitSet{0b1111}));
 
     EXPECT_THAT(Possibilities {9}, Eq(PossibilitiesBitSet{0b111111111}));
+
+    EXPECT_THAT(Possibilities {25}, Eq(PossibilitiesBitSet{0x1FFFFFF}));
+}
+
+TEST_F(TestPossibilities, GridSizeAboveMaxThrow)
+{
+    EXPECT_THROW(Possibilities {MaxGridSize + 1}, std::exception);
 }
 
 TEST_F(TestPossibilities, RemoveOneValue)
@@ -136,5 +143,26 @@ TEST_F(TestPossibilities, GetNumberPossibilitieLeftAndOnlyOnePossibilityLeft)
     EXPECT_TRUE(possibilities.OnlyOnePossibilityLeft());
 }
 
+TEST_F(TestPossibilities, PossibilitiesOf25x25Grid)
+{
+    Possibilities possibilities {25};
+
+    for (Value value = 1; value <= 25; value++)
+    {
+        if (value != 17 && value != 25)
+            possibilities.RemovePossibility(value);
+    }
+
+    EXPECT_THAT(possibilities.Count(), Eq(2));
+    EXPECT_THAT(possibilities.GetPossibilityLeft(), Eq(25));
+    EXPECT_THAT(possibilities.GetLowestPossibilityLeft(), Eq(17));
+    EXPECT_FALSE(possibilities.GetValue());
+
+    possibilities.RemovePossibility(25);
+
+    ASSERT_TRUE(possibilities.GetValue());
+    EXPECT_THAT(*possibilities.GetValue(), Eq(17));
+}
+
 } // namespace test
 } // namespace sudoku
@@ -4,6 +4,7 @@
 #include <gmock/gmock.h>
 
 #include "Grid.hpp"
+#include "StaticRelatedPositionsGetter.hpp"
 
 using testing::Eq;
 
@@ -72,6 +73,23 @@ TEST_F(TestRelatedPositionsGetter, GetRelatedBlockPositions)
     EXPECT_TRUE(IsPermutation(relatedPositions, expectedPositionsGroup));
 }
 
+TEST_F(TestRelatedPositionsGetter, GetRelatedBlockPositionsOfRectangularBlock)
+{
+    const int gridSize {6};
+
+    auto relatedPositions = m_RelatedPositionsGetter.GetRelatedBlockPositions(Position{3, 4}, gridSize);
+
+    std::vector<Position> expectedPositionsGroup {
+        Position{2, 3},
+        Position{2, 4},
+        Position{2, 5},
+        Position{3, 3},
+        Position{3, 5},
+    };
+
+    EXPECT_TRUE(IsPermutation(relatedPositions, expectedPositionsGroup));
+}
+
 TEST_F(TestRelatedPositionsGetter, GetAllRelatedPositions)
 {
     const int gridSize {4};
@@ -91,6 +109,57 @@ TEST_F(TestRelatedPositionsGetter, GetAllRelatedPositions)
     EXPECT_TRUE(IsPermutation(relatedPositions, expectedPositionsGroup));
 }
 
+TEST_F(TestRelatedPositionsGetter, GetAllRelatedPositions9x9)
+{
+    const int gridSize {9};
+
+    auto relatedPositions = m_RelatedPositionsGetter.GetAllRelatedPositions(Position{4, 7}, gridSize);
+
+    EXPECT_THAT(relatedPositions.size(), Eq(20));
+
+    for (auto const& position : relatedPositions)
+    {
+        const bool sameBlock = position.m_Row / 3 == 1 && position.m_Col / 3 == 2;
+
+        EXPECT_TRUE(position.m_Row == 4 || position.m_Col == 7 || sameBlock);
+        EXPECT_FALSE(position == (Position{4, 7}));
+    }
+}
+
+TEST_F(TestRelatedPositionsGetter, GetAllRelatedPositions25x25)
+{
+    const int gridSize {25};
+
+    auto relatedPositions = m_RelatedPositionsGetter.GetAllRelatedPositions(Position{12, 21}, gridSize);
+
+    EXPECT_THAT(relatedPositions.size(), Eq(64));
+
+    for (auto const& position : relatedPositions)
+    {
+        const bool sameBlock = position.m_Row / 5 == 2 && position.m_Col / 5 == 4;
+
+        EXPECT_TRUE(position.m_Row == 12 || position.m_Col == 21 || sameBlock);
+        EXPECT_FALSE(position == (Position{12, 21}));
+    }
+}
+
+TEST_F(TestRelatedPositionsGetter, StaticGetterMatchesRuntimeGetter)
+{
+    StaticRelatedPositionsGetter<9> staticRelatedPositionsGetter;
+
+    Position position {2, 5};
+
+    auto relatedPositions = m_RelatedPositionsGetter.GetAllRelatedPositions(position, 9);
+    auto staticRelatedPositions = staticRelatedPositionsGetter.GetAllRelatedPositions(position);
+
+    EXPECT_TRUE(std::equal(relatedPositions.begin(), relatedPositions.end(), staticRelatedPositions.begin(), staticRelatedPositions.end()));
+}
+
+TEST_F(TestRelatedPositionsGetter, UnsupportedGridSizeThrow)
+{
+    EXPECT_THROW(m_RelatedPositionsGetter.GetAllGroupsPositions(5), std::exception);
+}
+
 TEST_F(TestRelatedPositionsGetter, GetAllGroupsPositions)
 {
     const int gridSize {4};
@@ -23,7 +23,7 @@ public:
 
     std::unique_ptr<RelatedPossibilitiesRemover> MakeRelatedPossibilitiesRemover()
     {
-        return std::make_unique<RelatedPossibilitiesRemoverImpl>();
+        return std::make_unique<RelatedPossibilitiesRemoverImpl<m_GridSize>>();
     }
 
     Grid CreateExpectedGridWithValuePos1x1SetTo(Value value)
@@ -42,7 +42,7 @@ public:
         return grid;
     }
 
-    const int m_GridSize {4};
+    static constexpr int m_GridSize {4};
 };
 
 TEST_F(TestRelatedPossibilitiesRemover, RemoveSetValueFromRelatedCells)
@@ -53,10 +53,10 @@ TEST_F(TestRelatedPossibilitiesRemover, RemoveSetValueFromRelatedCells)
     FoundPositions foundPositions;
 
     Position currentPosition {1, 1};
-    auto& cell = grid.GetCell(currentPosition);
+    auto cell = grid.GetCell(currentPosition);
     cell.SetValue(cellValue);
 
-    MakeRelatedPossibilitiesRemover()->UpdateRelatedPossibilities(currentPosition, grid, foundPositions);
+    EXPECT_TRUE(MakeRelatedPossibilitiesRemover()->UpdateRelatedPossibilities(currentPosition, grid, foundPositions));
 
     auto expectedGrid = CreateExpectedGridWithValuePos1x1SetTo(cellValue);
 
@@ -73,13 +73,13 @@ TEST_F(TestRelatedPossibilitiesRemover, RemoveSetValueFromRelatedCells_RelatedCe
     FoundPositions foundPositions;
 
     Position currentPosition {1, 1};
-    auto& cell = grid.GetCell(currentPosition);
+    auto cell = grid.GetCell(currentPosition);
     cell.SetValue(cellValue);
 
     const Value otherCellFoundValue {1};
     grid.GetCell(Position{0, 0}).SetValue(otherCellFoundValue);
 
-    MakeRelatedPossibilitiesRemover()->UpdateRelatedPossibilities(currentPosition, grid, foundPositions);
+    EXPECT_TRUE(MakeRelatedPossibilitiesRemover()->UpdateRelatedPossibilities(currentPosition, grid, foundPositions));
 
     auto expectedGrid = CreateExpectedGridWithValuePos1x1SetTo(cellValue);
     expectedGrid.GetCell(Position{0, 0}).SetValue(otherCellFoundValue);
@@ -97,12 +97,12 @@ TEST_F(TestRelatedPossibilitiesRemover, RemoveSetValueFromRelatedCells_RelatedCe
     FoundPositions foundPositions;
 
     Position currentPosition {1, 1};
-    auto& cell = grid.GetCell(currentPosition);
+    auto cell = grid.GetCell(currentPosition);
     cell.SetValue(cellValue);
 
     grid.GetCell(Position{0, 0}).SetValue(cellValue);
 
-    EXPECT_THROW(MakeRelatedPossibilitiesRemover()->UpdateRelatedPossibilities(currentPosition, grid, foundPositions), std::exception);
+    EXPECT_FALSE(MakeRelatedPossibilitiesRemover()->UpdateRelatedPossibilities(currentPosition, grid, foundPositions));
 }
 
 TEST_F(TestRelatedPossibilitiesRemover, RemoveSetValueFromRelatedCells_FindNewCellValue)
@@ -113,13 +113,13 @@ TEST_F(TestRelatedPossibilitiesRemover, RemoveSetValueFromRelatedCells_FindNewCe
     FoundPositions foundPositions;
 
     Position currentPosition {1, 1};
-    auto& cell = grid.GetCell(currentPosition);
+    auto cell = grid.GetCell(currentPosition);
     cell.SetValue(cellValue);
 
     const Value NewFoundValue {2};
     RemoveAllCellPossibilitiesBut(grid.GetCell(Position{1, 3}), {cellValue, NewFoundValue});
 
-    MakeRelatedPossibilitiesRemover()->UpdateRelatedPossibilities(currentPosition, grid, foundPositions);
+    EXPECT_TRUE(MakeRelatedPossibilitiesRemover()->UpdateRelatedPossibilities(currentPosition, grid, foundPositions));
 
     auto expectedGrid = CreateExpectedGridWithValuePos1x1SetTo(cellValue);
     expectedGrid.GetCell(Position{1, 3}).SetValue(NewFoundValue);
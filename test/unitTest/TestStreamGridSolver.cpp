@@ -0,0 +1,171 @@
+#include "StreamGridSolver.hpp"
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <sstream>
+#include <stdexcept>
+
+#include "Grid.hpp"
+#include "GridText.hpp"
+
+using testing::Eq;
+
+namespace sudoku
+{
+namespace test
+{
+
+// Grids with a value in their first cell are solved by setting the value in all their empty cells,
+// grids with a value in their second cell make it throw
+class FakeGridSolver final : public GridSolver
+{
+public:
+    bool Solve(Grid& grid) const override
+    {
+        const auto value = grid.GetCell(0).GetValue();
+
+        if (grid.GetCell(1).GetValue())
+            throw std::runtime_error("solver error");
+
+        if (!value)
+            return false;
+
+        for (int index = 0; index < grid.GetCellsCount(); index++)
+            grid.SetValue(index, *value);
+
+        return true;
+    }
+};
+
+class TestStreamGridSolver : public ::testing::Test
+{
+public:
+    TestStreamGridSolver()
+    {}
+
+    std::unique_ptr<StreamGridSolver> MakeStreamGridSolver(int threadsCount)
+    {
+        std::vector<std::unique_ptr<GridSolver>> gridSolvers;
+
+        for (int i = 0; i < threadsCount; i++)
+            gridSolvers.push_back(std::make_unique<FakeGridSolver>());
+
+        return std::make_unique<StreamGridSolverImpl>(std::move(gridSolvers));
+    }
+};
+
+TEST_F(TestStreamGridSolver, SolutionsWrittenInInputOrder)
+{
+    std::string input;
+    std::string expectedOutput;
+
+    for (int i = 0; i < 2'000; i++)
+    {
+        const auto value = std::to_string(i % 4 + 1);
+        input += value + "...............\n";
+        expectedOutput += std::string(16, value[0]) + "\n";
+    }
+
+    std::istringstream inputStream {input};
+    std::ostringstream outputStream;
+
+    const auto report = MakeStreamGridSolver(3)->Solve(inputStream, outputStream);
+
+    EXPECT_THAT(outputStream.str(), Eq(expectedOutput));
+    EXPECT_THAT(report.m_GridsCount, Eq(2'000u));
+    EXPECT_THAT(report.m_UnsolvedGridsCount, Eq(0u));
+    EXPECT_THAT(report.m_InvalidLinesCount, Eq(0u));
+}
+
+TEST_F(TestStreamGridSolver, EmptyLineWrittenForUnsolvedGridsAndInvalidLines)
+{
+    std::istringstream inputStream {"1...............\r\n\n................\nnot a grid\n2..............."};
+    std::ostringstream outputStream;
+
+    const auto report = MakeStreamGridSolver(2)->Solve(inputStream, outputStream);
+
+    EXPECT_THAT(outputStream.str(), Eq("1111111111111111\n\n\n2222222222222222\n"));
+    EXPECT_THAT(report.m_GridsCount, Eq(3u));
+    EXPECT_THAT(report.m_UnsolvedGridsCount, Eq(1u));
+    EXPECT_THAT(report.m_InvalidLinesCount, Eq(1u));
+}
+
+TEST_F(TestStreamGridSolver, SolutionsOfInputInMemoryWrittenInInputOrder)
+{
+    std::string input;
+    std::string expectedOutput;
+
+    // Spans several chunks
+    for (int i = 0; i < 5'000; i++)
+    {
+        const auto value = std::to_string(i % 4 + 1);
+        input += value + "...............\n";
+        expectedOutput += std::string(16, value[0]) + "\n";
+    }
+
+    input += "\n3...............";
+    expectedOutput += "3333333333333333\n";
+
+    std::ostringstream outputStream;
+
+    const auto report = MakeStreamGridSolver(3)->Solve(std::string_view {input}, outputStream);
+
+    EXPECT_THAT(outputStream.str(), Eq(expectedOutput));
+    EXPECT_THAT(report.m_GridsCount, Eq(5'001u));
+}
+
+TEST_F(TestStreamGridSolver, LineLongerThanChunkCountedAsSingleInvalidLine)
+{
+    // Its tail would be a grid if the line was split at the chunk size
+    const auto input = std::string(3 * 32'768, '.') + "1...............\n2...............\n";
+
+    std::istringstream inputStream {input};
+    std::ostringstream outputStream;
+
+    const auto report = MakeStreamGridSolver(2)->Solve(inputStream, outputStream);
+
+    EXPECT_THAT(outputStream.str(), Eq("\n2222222222222222\n"));
+    EXPECT_THAT(report.m_GridsCount, Eq(1u));
+    EXPECT_THAT(report.m_InvalidLinesCount, Eq(1u));
+
+    std::ostringstream memoryOutputStream;
+
+    EXPECT_THAT(MakeStreamGridSolver(2)->Solve(std::string_view {input}, memoryOutputStream).m_InvalidLinesCount, Eq(1u));
+    EXPECT_THAT(memoryOutputStream.str(), Eq(outputStream.str()));
+}
+
+TEST_F(TestStreamGridSolver, SolverErrorIsThrownAndNotCountedAsInvalidLine)
+{
+    std::string input;
+
+    for (int i = 0; i < 5'000; i++)
+        input += i == 2'500 ? "12..............\n" : "1...............\n";
+
+    std::istringstream inputStream {input};
+    std::ostringstream outputStream;
+
+    EXPECT_THROW(MakeStreamGridSolver(3)->Solve(inputStream, outputStream), std::runtime_error);
+    EXPECT_THROW(MakeStreamGridSolver(3)->Solve(std::string_view {input}, outputStream), std::runtime_error);
+}
+
+TEST_F(TestStreamGridSolver, EmptyInput)
+{
+    std::istringstream inputStream;
+    std::ostringstream outputStream;
+
+    const auto report = MakeStreamGridSolver(2)->Solve(inputStream, outputStream);
+
+    EXPECT_THAT(outputStream.str(), Eq(""));
+    EXPECT_THAT(report.m_GridsCount, Eq(0u));
+
+    EXPECT_THAT(MakeStreamGridSolver(2)->Solve(std::string_view {}, outputStream).m_GridsCount, Eq(0u));
+}
+
+TEST_F(TestStreamGridSolver, StreamGridSolverWithoutGridSolverThrows)
+{
+    EXPECT_THROW(MakeStreamGridSolver(0), std::runtime_error);
+}
+
+} /* namespace test */
+} /* namespace sudoku */
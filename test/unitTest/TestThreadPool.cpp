@@ -0,0 +1,78 @@
+#include "ThreadPool.hpp"
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <atomic>
+#include <stdexcept>
+
+using testing::Eq;
+
+namespace sudoku
+{
+namespace test
+{
+
+class TestThreadPool : public ::testing::Test
+{
+public:
+    TestThreadPool()
+    {}
+
+    std::atomic<int> m_TasksRun {0};
+};
+
+TEST_F(TestThreadPool, AllSubmittedTasksRun)
+{
+    ThreadPool threadPool {3};
+
+    const int tasksCount {100};
+
+    for (int i = 0; i < tasksCount; i++)
+        threadPool.Submit([this, &threadPool]{ m_TasksRun++; threadPool.WakeUp(); });
+
+    threadPool.RunTasksUntil([this]{ return m_TasksRun == tasksCount; });
+
+    EXPECT_THAT(m_TasksRun.load(), Eq(tasksCount));
+}
+
+TEST_F(TestThreadPool, TasksSubmittedByTasksRun)
+{
+    ThreadPool threadPool {2};
+
+    for (int i = 0; i < 10; i++)
+    {
+        threadPool.Submit([this, &threadPool]
+            {
+                for (int j = 0; j < 10; j++)
+                    threadPool.Submit([this, &threadPool]{ m_TasksRun++; threadPool.WakeUp(); });
+            });
+    }
+
+    threadPool.RunTasksUntil([this]{ return m_TasksRun == 100; });
+
+    EXPECT_THAT(m_TasksRun.load(), Eq(100));
+}
+
+TEST_F(TestThreadPool, WaitingThreadRunsTasksWhenWorkersAreBusy)
+{
+    ThreadPool threadPool {1};
+
+    std::atomic<bool> released {false};
+
+    // Whichever of the two tasks the only worker runs first, the other one is run by the waiting thread
+    threadPool.Submit([this, &threadPool, &released]{ while (!released) {} m_TasksRun++; threadPool.WakeUp(); });
+    threadPool.Submit([this, &threadPool, &released]{ released = true; m_TasksRun++; threadPool.WakeUp(); });
+
+    threadPool.RunTasksUntil([this]{ return m_TasksRun == 2; });
+
+    EXPECT_THAT(m_TasksRun.load(), Eq(2));
+}
+
+TEST_F(TestThreadPool, PoolWithoutThreadThrows)
+{
+    EXPECT_THROW(ThreadPool {0}, std::runtime_error);
+}
+
+} /* namespace test */
+} /* namespace sudoku */
@@ -0,0 +1,130 @@
+#include "Trail.hpp"
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include "Grid.hpp"
+
+using testing::Eq;
+
+namespace sudoku
+{
+namespace test
+{
+
+class TestTrail : public ::testing::Test
+{
+public:
+    TestTrail()
+    {}
+
+    Trail m_Trail {MaxGridSize * MaxGridSize};
+};
+
+TEST_F(TestTrail, RollBackRestoresModifiedCells)
+{
+    Grid grid {4};
+    grid.GetCell(Position{0, 0}).SetValue(1);
+
+    const auto gridBeforeModifications = grid;
+
+    ScopedTrail scopedTrail {grid, m_Trail};
+    const auto checkpoint = grid.GetTrailCheckpoint();
+
+    grid.GetCell(Position{1, 1}).SetValue(2);
+    grid.GetCell(Position{2, 3}).RemovePossibility(4);
+    grid.GetCell(Position{2, 3}).RemovePossibility(3);
+
+    grid.RollBack(checkpoint);
+
+    EXPECT_THAT(grid, Eq(gridBeforeModifications));
+    EXPECT_THAT(m_Trail.GetEntriesCount(), Eq(checkpoint));
+}
+
+TEST_F(TestTrail, RollBackToIntermediateCheckpoint)
+{
+    Grid grid {4};
+
+    ScopedTrail scopedTrail {grid, m_Trail};
+
+    grid.GetCell(Position{1, 1}).SetValue(2);
+
+    const auto checkpoint = grid.GetTrailCheckpoint();
+    const auto gridAtCheckpoint = grid;
+
+    grid.GetCell(Position{1, 1}).RemovePossibility(2);
+    grid.GetCell(Position{3, 0}).SetValue(4);
+
+    grid.RollBack(checkpoint);
+
+    EXPECT_THAT(grid, Eq(gridAtCheckpoint));
+}
+
+TEST_F(TestTrail, CellRecordedOnceBetweenCheckpoints)
+{
+    Grid grid {4};
+
+    ScopedTrail scopedTrail {grid, m_Trail};
+
+    grid.GetCell(Position{0, 0}).RemovePossibility(1);
+    grid.GetCell(Position{0, 0}).RemovePossibility(2);
+
+    EXPECT_THAT(m_Trail.GetEntriesCount(), Eq(1u));
+
+    const auto checkpoint = grid.GetTrailCheckpoint();
+    const auto gridAtCheckpoint = grid;
+
+    grid.GetCell(Position{0, 0}).RemovePossibility(3);
+
+    EXPECT_THAT(m_Trail.GetEntriesCount(), Eq(2u));
+
+    grid.RollBack(checkpoint);
+    EXPECT_THAT(grid, Eq(gridAtCheckpoint));
+
+    grid.GetCell(Position{0, 0}).RemovePossibility(4);
+    grid.RollBack(checkpoint);
+    EXPECT_THAT(grid, Eq(gridAtCheckpoint));
+}
+
+TEST_F(TestTrail, RemovingAbsentPossibilityIsNotRecorded)
+{
+    Grid grid {4};
+    grid.GetCell(Position{0, 0}).RemovePossibility(1);
+
+    ScopedTrail scopedTrail {grid, m_Trail};
+
+    EXPECT_TRUE(grid.GetCell(Position{0, 0}).RemovePossibility(1));
+
+    EXPECT_THAT(m_Trail.GetEntriesCount(), Eq(0u));
+}
+
+TEST_F(TestTrail, ModificationsOutsideScopeAreNotRecorded)
+{
+    Grid grid {4};
+
+    {
+        ScopedTrail scopedTrail {grid, m_Trail};
+        grid.GetCell(Position{0, 0}).SetValue(1);
+    }
+
+    grid.GetCell(Position{1, 0}).SetValue(2);
+
+    EXPECT_THAT(grid.GetTrail(), Eq(nullptr));
+    EXPECT_THAT(m_Trail.GetEntriesCount(), Eq(1u));
+}
+
+TEST_F(TestTrail, CopyOfGridIsNotRecorded)
+{
+    Grid grid {4};
+
+    ScopedTrail scopedTrail {grid, m_Trail};
+
+    auto copy = grid;
+    copy.GetCell(Position{0, 0}).SetValue(1);
+
+    EXPECT_THAT(copy.GetTrail(), Eq(nullptr));
+    EXPECT_THAT(m_Trail.GetEntriesCount(), Eq(0u));
+}
+
+} // namespace test
+} // namespace sudoku
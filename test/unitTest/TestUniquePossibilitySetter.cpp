@@ -7,6 +7,7 @@
 #include "utils/Utils.hpp"
 
 using testing::Eq;
+using testing::UnorderedElementsAre;
 
 namespace sudoku
 {
@@ -31,7 +32,7 @@ public:
 
     FoundPositions m_FoundPositions;
 
-    UniquePossibilitySetterImpl m_UniquePossibilitySetter;
+    UniquePossibilitySetterImpl<4> m_UniquePossibilitySetter;
 };
 
 TEST_F(TestUniquePossibilitySetter, NoUniquePossibility)
@@ -39,7 +40,7 @@ TEST_F(TestUniquePossibilitySetter, NoUniquePossibility)
     const int gridSize {4};
     Grid grid {gridSize};
 
-    m_UniquePossibilitySetter.SetCellsWithUniquePossibility(grid, m_FoundPositions);
+    EXPECT_TRUE(m_UniquePossibilitySetter.SetCellsWithUniquePossibility(grid, m_FoundPositions));
 
     EXPECT_TRUE(m_FoundPositions.empty());
     EXPECT_THAT(grid, Eq(Grid {gridSize}));
@@ -58,13 +59,29 @@ TEST_F(TestUniquePossibilitySetter, UniquePossibility)
     auto expectedGrid = grid;
     expectedGrid.GetCell(positionWithUniqueValue).SetValue(newFoundValue);
 
-    m_UniquePossibilitySetter.SetCellsWithUniquePossibility(grid, m_FoundPositions);
+    EXPECT_TRUE(m_UniquePossibilitySetter.SetCellsWithUniquePossibility(grid, m_FoundPositions));
 
     EXPECT_THAT(QueueToVector(m_FoundPositions), Eq(std::vector<Position>{positionWithUniqueValue}));
 
     EXPECT_THAT(grid, Eq(expectedGrid));
 }
 
+TEST_F(TestUniquePossibilitySetter, GroupsNotTouchedSincePreviousCallAreNotExamined)
+{
+    const int gridSize {4};
+    Grid grid {gridSize};
+
+    RemovePossibilityFromRelatedCol(grid, Position{1, 0}, 1);
+
+    grid.TakeTouchedUnits();
+    const auto expectedGrid = grid;
+
+    EXPECT_TRUE(m_UniquePossibilitySetter.SetCellsWithUniquePossibility(grid, m_FoundPositions));
+
+    EXPECT_TRUE(m_FoundPositions.empty());
+    EXPECT_THAT(grid, Eq(expectedGrid));
+}
+
 TEST_F(TestUniquePossibilitySetter, TwoUniquePossibilitiesInGroup)
 {
     const int gridSize {4};
@@ -83,14 +100,14 @@ TEST_F(TestUniquePossibilitySetter, TwoUniquePossibilitiesInGroup)
     expectedGrid.GetCell(positionWithUniqueValue1).SetValue(newFoundValue1);
     expectedGrid.GetCell(positionWithUniqueValue2).SetValue(newFoundValue2);
 
-    m_UniquePossibilitySetter.SetCellsWithUniquePossibility(grid, m_FoundPositions);
+    EXPECT_TRUE(m_UniquePossibilitySetter.SetCellsWithUniquePossibility(grid, m_FoundPositions));
 
-    EXPECT_THAT(QueueToVector(m_FoundPositions), Eq(std::vector<Position>{positionWithUniqueValue1, positionWithUniqueValue2}));
+    EXPECT_THAT(QueueToVector(m_FoundPositions), UnorderedElementsAre(positionWithUniqueValue1, positionWithUniqueValue2));
 
     EXPECT_THAT(grid, Eq(expectedGrid));
 }
 
-TEST_F(TestUniquePossibilitySetter, SeveralUniquePossibilitiesInSameCellsThrow)
+TEST_F(TestUniquePossibilitySetter, SeveralUniquePossibilitiesInSameCellsFail)
 {
     const int gridSize {4};
     Grid grid {gridSize};
@@ -100,7 +117,20 @@ TEST_F(TestUniquePossibilitySetter, SeveralUniquePossibilitiesInSameCellsThrow)
     RemovePossibilityFromRelatedCol(grid, positionWithUniqueValue1, 1);
     RemovePossibilityFromRelatedCol(grid, positionWithUniqueValue1, 3);
 
-    EXPECT_THROW( m_UniquePossibilitySetter.SetCellsWithUniquePossibility(grid, m_FoundPositions), std::exception);
+    EXPECT_FALSE(m_UniquePossibilitySetter.SetCellsWithUniquePossibility(grid, m_FoundPositions));
+}
+
+TEST_F(TestUniquePossibilitySetter, ValueWithNoCellLeftInGroupFail)
+{
+    const int gridSize {4};
+    Grid grid {gridSize};
+
+    const Value missingValue {2};
+
+    for (int col = 0; col < gridSize; col++)
+        grid.GetCell(Position{3, col}).RemovePossibility(missingValue);
+
+    EXPECT_FALSE(m_UniquePossibilitySetter.SetCellsWithUniquePossibility(grid, m_FoundPositions));
 }
 
 } /* namespace test */
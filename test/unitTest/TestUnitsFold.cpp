@@ -0,0 +1,95 @@
+#include "UnitsFold.hpp"
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include "Grid.hpp"
+#include "utils/Utils.hpp"
+
+using testing::Eq;
+
+namespace sudoku
+{
+namespace test
+{
+
+class TestUnitsFold : public ::testing::Test
+{
+public:
+    void ExpectSameFoldAsScalar(Grid const& grid)
+    {
+        const auto fold = FoldSetValues(grid);
+        const auto scalarFold = detail::FoldSetValuesScalar(grid);
+
+        for (int unit = 0; unit < grid.GetUnits().GetUnitsCount(); unit++)
+        {
+            EXPECT_THAT(fold.m_SetValues[unit], Eq(scalarFold.m_SetValues[unit]));
+            EXPECT_THAT(fold.m_DuplicatedValues[unit], Eq(scalarFold.m_DuplicatedValues[unit]));
+        }
+    }
+};
+
+TEST_F(TestUnitsFold, SolvedGridHasAllValuesInEveryUnit)
+{
+    const int gridSize {9};
+    const auto grid = CreateGrid(gridSize, CreateSolvedPositionsValues(gridSize));
+
+    const auto fold = FoldSetValues(grid);
+
+    for (int unit = 0; unit < grid.GetUnits().GetUnitsCount(); unit++)
+    {
+        EXPECT_THAT(fold.m_SetValues[unit], Eq(PossibilitiesBitSet{0b111111111}));
+        EXPECT_THAT(fold.m_DuplicatedValues[unit], Eq(PossibilitiesBitSet{0}));
+    }
+}
+
+TEST_F(TestUnitsFold, CellsNotSetAreIgnored)
+{
+    Grid grid {4};
+
+    grid.GetCell(Position{2, 3}).SetValue(2);
+    grid.GetCell(Position{0, 0}).RemovePossibility(2);
+
+    const auto fold = FoldSetValues(grid);
+
+    EXPECT_THAT(fold.m_SetValues[3], Eq(PossibilitiesBitSet{0b0010}));
+    EXPECT_THAT(fold.m_SetValues[4 + 2], Eq(PossibilitiesBitSet{0b0010}));
+    EXPECT_THAT(fold.m_SetValues[8 + 3], Eq(PossibilitiesBitSet{0b0010}));
+    EXPECT_THAT(fold.m_SetValues[0], Eq(PossibilitiesBitSet{0}));
+}
+
+TEST_F(TestUnitsFold, DuplicatedValueInBlock)
+{
+    Grid grid {6};
+
+    grid.GetCell(Position{2, 3}).SetValue(5);
+    grid.GetCell(Position{3, 5}).SetValue(5);
+    grid.GetCell(Position{3, 4}).SetValue(5);
+
+    const auto fold = FoldSetValues(grid);
+
+    EXPECT_THAT(fold.m_DuplicatedValues[12 + 3], Eq(PossibilitiesBitSet{0b10000}));
+    EXPECT_THAT(fold.m_DuplicatedValues[6 + 3], Eq(PossibilitiesBitSet{0b10000}));
+    EXPECT_THAT(fold.m_DuplicatedValues[12 + 1], Eq(PossibilitiesBitSet{0}));
+    EXPECT_THAT(fold.m_DuplicatedValues[5], Eq(PossibilitiesBitSet{0}));
+}
+
+TEST_F(TestUnitsFold, SameFoldAsScalar)
+{
+    for (const int gridSize : {4, 6, 9, 16, 25})
+    {
+        // Setting the remaining cells to 1 duplicates it in most units
+        auto grid = CreateGrid(gridSize, KeepRandomCells(CreateSolvedPositionsValues(gridSize), gridSize * gridSize / 2));
+
+        for (auto cell : grid)
+        {
+            if (!cell.IsSet())
+                cell.SetValue(1);
+        }
+
+        ExpectSameFoldAsScalar(grid);
+    }
+}
+
+} /* namespace test */
+} /* namespace sudoku */
@@ -1,13 +1,18 @@
 #include <unordered_map>
+#include <unordered_set>
 #include <vector>
 #include <numeric>
 #include <queue>
+#include <string>
+#include <cmath>
+#include <cctype>
 
 #include <boost/range/algorithm_ext.hpp>
 
 #include "Cell.hpp"
 #include "Value.hpp"
 #include "Grid.hpp"
+#include "GridSize.hpp"
 
 namespace sudoku
 {
@@ -16,7 +21,7 @@ namespace test
 
 using PositionsValues = std::vector<std::pair<Position, Value>>;
 
-inline void RemoveAllCellPossibilitiesBut(Cell& cell, std::unordered_set<Value> const& possibilitiesToKeep)
+inline void RemoveAllCellPossibilitiesBut(Cell cell, std::unordered_set<Value> const& possibilitiesToKeep)
 {
     std::vector<Value> possibilitiesToRemove(9);
     std::iota(possibilitiesToRemove.begin(), possibilitiesToRemove.end(), 1);
@@ -169,6 +174,68 @@ inline PositionsValues CreatePositionsValues4x4()
     };
 }
 
+// Solved grid of any supported size, built by shifting the first row
+inline PositionsValues CreateSolvedPositionsValues(int gridSize)
+{
+    const int blockRows = GetBlockRows(gridSize);
+    const int blockCols = GetBlockCols(gridSize);
+
+    PositionsValues positionsValues;
+
+    for (int row = 0; row < gridSize; row++)
+    {
+        for (int col = 0; col < gridSize; col++)
+        {
+            const int shift = blockCols * (row % blockRows) + row / blockRows;
+            positionsValues.push_back({Position{row, col}, Value{(shift + col) % gridSize + 1}});
+        }
+    }
+
+    return positionsValues;
+}
+
+// Parse a grid written on one line, row after row, with '.' or '0' for empty cells
+// and 'A', 'B', ... for the values from 10
+inline PositionsValues ParsePositionsValues(std::string const& line)
+{
+    PositionsValues positionsValues;
+
+    const int gridSize = std::sqrt(line.size());
+
+    for (int i = 0; i < static_cast<int>(line.size()); i++)
+    {
+        if (line[i] == '.' || line[i] == '0')
+            continue;
+
+        const Value value = std::isdigit(line[i]) ? line[i] - '0' : line[i] - 'A' + 10;
+        positionsValues.push_back({Position{i / gridSize, i % gridSize}, value});
+    }
+
+    return positionsValues;
+}
+
+// Hard 9x9 grids needing a lot of hypotheses to be solved
+inline std::vector<PositionsValues> CreateHardGrids9x9()
+{
+    const std::vector<std::string> lines {
+        "8..........36......7..9.2...5...7.......457.....1...3...1....68..85...1..9....4..",
+        "1....7.9..3..2...8..96..5....53..9...1..8...26....4...3......1..4......7..7...3..",
+        "4.....8.5.3..........7......2.....6.....8.4......1.......6.3.7.5..2.....1.4......",
+        "52...6.........7.13...........4..8..6......5...........418.........3..2...87.....",
+        "6.....8.3.4.7.................5.4.7.3..2.....1.6.......2.....5.....8.6......1....",
+        "48.3............71.2.......7.5....6....2..8.............1.76...3.....4......5....",
+        "....14....3....2...7..........9...3.6.1.............8.2.....1.4....5.6.....7.8...",
+        ".......39.....1..5..3.5.8....8.9...6.7...2...1..4.......9.8..5..2....6..4..7.....",
+    };
+
+    std::vector<PositionsValues> grids;
+
+    for (auto const& line : lines)
+        grids.push_back(ParsePositionsValues(line));
+
+    return grids;
+}
+
 inline PositionsValues KeepRandomCells(PositionsValues positionsValues, int cellKeptCount)
 {
     std::random_shuffle(positionsValues.begin(), positionsValues.end());